@@ -0,0 +1,87 @@
+#pragma once
+#ifndef JW_BITMASK_UTILS_H
+#define JW_BITMASK_UTILS_H
+
+//************Content************
+#include <vector>
+#include <cstdint>
+#include <bit>
+
+namespace Utils
+{
+	/**
+	 * @brief Compact mask of flags, one bit per element. Bit i is stored in data()[i / 64] at bit (i % 64).
+	 * Bits after size() in the last word are always 0.
+	 *
+     * @code{.cpp}
+     * Utils::BitMask mask(values.size());
+	 * mask.set(3);
+	 * if (mask.test(3)) ...
+	 * size_t flagged = mask.count();
+     * @endcode
+     * @date 2026-10-16
+	*/
+	class BitMask
+	{
+		public:
+			BitMask() : m_size(0) {}
+			BitMask(size_t size, bool value = false) { assign(size, value); }
+
+			/**
+			 * @brief Resize the mask and set all bits to value
+			 * @param size Number of bits
+			 * @param value Value of all bits
+			*/
+			void assign(size_t size, bool value = false)
+			{
+				m_size = size;
+				m_words.assign((size + 63) / 64, value ? ~(uint64_t)0 : 0);
+				clearTail();
+			}
+
+			size_t size() const { return m_size; }
+			size_t wordCount() const { return m_words.size(); }
+			uint64_t* data() { return m_words.data(); }
+			const uint64_t* data() const { return m_words.data(); }
+
+			bool test(size_t index) const
+			{
+				return (m_words[index >> 6] >> (index & 63)) & 1;
+			}
+
+			void set(size_t index, bool value = true)
+			{
+				uint64_t bit = (uint64_t)1 << (index & 63);
+				if (value) m_words[index >> 6] |= bit;
+				else m_words[index >> 6] &= ~bit;
+			}
+
+			/**
+			 * @brief Count the bits which are set
+			 * @return Return the number of bits which are set
+			*/
+			size_t count() const
+			{
+				size_t result = 0;
+				for (size_t i = 0; i < m_words.size(); i++)
+				{
+					result += std::popcount(m_words[i]);
+				}
+				return result;
+			}
+
+		private:
+			void clearTail()
+			{
+				if (m_size % 64 != 0) m_words.back() &= ((uint64_t)1 << (m_size % 64)) - 1;
+			}
+
+			std::vector<uint64_t> m_words;
+			size_t m_size;
+	};
+}
+
+
+//*******************************
+
+#endif
@@ -0,0 +1,276 @@
+#pragma once
+#ifndef JW_EXPRESSION_UTILS_H
+#define JW_EXPRESSION_UTILS_H
+
+//************Content************
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <type_traits>
+
+namespace Utils
+{
+	/**
+	 * @brief Size of a scalar in an expression. A scalar is broadcasted to the size of the other side.
+	*/
+	constexpr size_t BROADCAST_SIZE = SIZE_MAX;
+
+	/**
+	 * @brief Base of all vector expressions for lazy vector arithmetic. An expression like expression(a) * b + 2.0 builds a tree of small objects instead of temporary
+	 * vectors, and evaluate() calculates the whole tree in one loop into a single destination. Elements are always calculated in double,
+	 * so integers above 2^53 are rounded. It differs from addition(), subtraction() and multiple(), which are exact on integer vectors;
+	 * use them for large 64-bit integers. Division by 0 follows IEEE, i.e. inf or nan, instead of skipping.
+	 *
+	 * @code{.cpp}
+	 * std::vector<int> a, b;
+	 * std::vector<float> c;
+	 *
+	 * // a * b + c / 2
+	 * std::vector<double> result = Utils::evaluate<double>(Utils::expression(a) * b + Utils::expression(c) / 2);
+	 *
+	 * // Reuse a buffer
+	 * std::vector<double> buffer(a.size());
+	 * Utils::evaluate<double>((Utils::expression(a) - 1.5) * c, std::span<double>(buffer));
+	 * @endcode
+	 * @tparam E Derived expression
+	 * @date 2026-10-16
+	*/
+	template <typename E>
+	class VectorExpression
+	{
+		public:
+			const E& self() const
+			{
+				return static_cast<const E&>(*this);
+			}
+	};
+
+	/**
+	 * @brief Expression of a vector. It only keeps a view on the values, which must outlive the expression.
+	 * @tparam T Numerical type
+	 * @date 2026-10-16
+	*/
+	template <typename T>
+	class VectorTerminal : public VectorExpression<VectorTerminal<T>>
+	{
+		public:
+			VectorTerminal(std::span<const T> values) : m_values(values) {}
+
+			double operator[](size_t index) const { return (double)m_values[index]; }
+			size_t size() const { return m_values.size(); }
+			bool isValid() const { return true; }
+
+		private:
+			std::span<const T> m_values;
+	};
+
+	/**
+	 * @brief Expression of a scalar which is broadcasted
+	 * @date 2026-10-16
+	*/
+	class ScalarTerminal : public VectorExpression<ScalarTerminal>
+	{
+		public:
+			ScalarTerminal(double value) : m_value(value) {}
+
+			double operator[](size_t) const { return m_value; }
+			size_t size() const { return BROADCAST_SIZE; }
+			bool isValid() const { return true; }
+
+		private:
+			double m_value;
+	};
+
+	/**
+	 * @brief Expression of left op right
+	 * @tparam L Left expression
+	 * @tparam R Right expression
+	 * @tparam Op Operator with static double apply(double, double)
+	 * @date 2026-10-16
+	*/
+	template <typename L, typename R, typename Op>
+	class BinaryExpression : public VectorExpression<BinaryExpression<L, R, Op>>
+	{
+		public:
+			BinaryExpression(const L& left, const R& right) : m_left(left), m_right(right) {}
+
+			double operator[](size_t index) const { return Op::apply(m_left[index], m_right[index]); }
+			size_t size() const { return m_left.size() != BROADCAST_SIZE ? m_left.size() : m_right.size(); }
+
+			/**
+			 * @brief Check whether sizes of all vectors in the expression are the same
+			 * @return Return true if sizes matched
+			*/
+			bool isValid() const
+			{
+				return m_left.isValid() && m_right.isValid() &&
+					(m_left.size() == m_right.size() || m_left.size() == BROADCAST_SIZE || m_right.size() == BROADCAST_SIZE);
+			}
+
+		private:
+			// Children are kept by value, they are views and small nodes
+			L m_left;
+			R m_right;
+	};
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		struct AdditionOperator { static double apply(double a, double b) { return a + b; } };
+		struct SubtractionOperator { static double apply(double a, double b) { return a - b; } };
+		struct MultipleOperator { static double apply(double a, double b) { return a * b; } };
+		struct DivisionOperator { static double apply(double a, double b) { return a / b; } };
+
+		/**
+		 * @brief Convert an operand to an expression node. Vectors become VectorTerminal, numbers become ScalarTerminal.
+		*/
+		template <typename X, typename Enable = void>
+		struct ExpressionNode
+		{
+			static constexpr bool valid = false;
+			static constexpr bool isExpression = false;
+		};
+
+		template <typename E>
+		struct ExpressionNode<E, std::enable_if_t<std::is_base_of_v<VectorExpression<E>, E>>>
+		{
+			static constexpr bool valid = true;
+			static constexpr bool isExpression = true;
+			using type = E;
+			static const E& make(const E& expression) { return expression; }
+		};
+
+		template <typename T>
+		struct ExpressionNode<std::vector<T>, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+		{
+			static constexpr bool valid = true;
+			static constexpr bool isExpression = false;
+			using type = VectorTerminal<T>;
+			static type make(const std::vector<T>& values) { return type(std::span<const T>(values)); }
+		};
+
+		template <typename T>
+		struct ExpressionNode<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+		{
+			static constexpr bool valid = true;
+			static constexpr bool isExpression = false;
+			using type = ScalarTerminal;
+			static type make(T value) { return type((double)value); }
+		};
+
+		/**
+		 * @brief Operators are only enabled if one side is already an expression, so that operators of std::vector are not hijacked.
+		*/
+		template <typename A, typename B>
+		constexpr bool is_expression_operands = ExpressionNode<A>::valid && ExpressionNode<B>::valid &&
+			(ExpressionNode<A>::isExpression || ExpressionNode<B>::isExpression);
+
+		template <typename Op, typename A, typename B>
+		using BinaryExpressionOf = BinaryExpression<typename ExpressionNode<A>::type, typename ExpressionNode<B>::type, Op>;
+
+		template <typename Op, typename A, typename B>
+		BinaryExpressionOf<Op, A, B> makeBinaryExpression(const A& a, const B& b)
+		{
+			return BinaryExpressionOf<Op, A, B>(ExpressionNode<A>::make(a), ExpressionNode<B>::make(b));
+		}
+	}
+
+	/**
+	 * @brief Create an expression from a vector
+	 * @tparam T Numerical type
+	 * @param values Values. It must outlive the expression.
+	 * @return Return the expression
+	 * @date 2026-10-16
+	*/
+	template <typename T>
+	VectorTerminal<T> expression(const std::vector<T>& values)
+	{
+		return VectorTerminal<T>(std::span<const T>(values));
+	}
+
+	/**
+	 * @brief Create an expression from a span
+	 * @tparam T Numerical type
+	 * @param values Values. It must outlive the expression.
+	 * @return Return the expression
+	 * @date 2026-10-16
+	*/
+	template <typename T>
+	VectorTerminal<T> expression(std::span<const T> values)
+	{
+		return VectorTerminal<T>(values);
+	}
+
+	// Operators, one side must be an expression. The other side can be an expression, a std::vector or a number.
+
+	template <typename A, typename B, typename = std::enable_if_t<Detail::is_expression_operands<A, B>>>
+	Detail::BinaryExpressionOf<Detail::AdditionOperator, A, B> operator+(const A& a, const B& b)
+	{
+		return Detail::makeBinaryExpression<Detail::AdditionOperator>(a, b);
+	}
+
+	template <typename A, typename B, typename = std::enable_if_t<Detail::is_expression_operands<A, B>>>
+	Detail::BinaryExpressionOf<Detail::SubtractionOperator, A, B> operator-(const A& a, const B& b)
+	{
+		return Detail::makeBinaryExpression<Detail::SubtractionOperator>(a, b);
+	}
+
+	template <typename A, typename B, typename = std::enable_if_t<Detail::is_expression_operands<A, B>>>
+	Detail::BinaryExpressionOf<Detail::MultipleOperator, A, B> operator*(const A& a, const B& b)
+	{
+		return Detail::makeBinaryExpression<Detail::MultipleOperator>(a, b);
+	}
+
+	template <typename A, typename B, typename = std::enable_if_t<Detail::is_expression_operands<A, B>>>
+	Detail::BinaryExpressionOf<Detail::DivisionOperator, A, B> operator/(const A& a, const B& b)
+	{
+		return Detail::makeBinaryExpression<Detail::DivisionOperator>(a, b);
+	}
+
+	/**
+	 * @brief Evaluate an expression into a caller provided buffer in one loop. The buffer can be one of the vectors in the expression.
+	 * @tparam R Return Numerical type.
+	 * @tparam E Expression
+	 * @param[in] expression Expression to be evaluated
+	 * @param[out] result Result. Its size must be the same as the expression.
+	 * @return Return false if sizes of the vectors are not matched or the expression only contains scalars.
+	 * @date 2026-10-16
+	*/
+	template <typename R, typename E>
+	bool evaluate(const VectorExpression<E>& expression, std::span<R> result)
+	{
+		const E& root = expression.self();
+		if (!root.isValid() || root.size() == BROADCAST_SIZE || root.size() != result.size()) return false;
+
+		size_t size = result.size();
+		for (size_t i = 0; i < size; i++)
+		{
+			result[i] = static_cast<R>(root[i]);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Evaluate an expression in one loop
+	 * @tparam R Return Numerical type.
+	 * @tparam E Expression
+	 * @param[in] expression Expression to be evaluated
+	 * @return Return the result. Return empty vector if sizes of the vectors are not matched or the expression only contains scalars.
+	 * @date 2026-10-16
+	*/
+	template <typename R, typename E>
+	std::vector<R> evaluate(const VectorExpression<E>& expression)
+	{
+		const E& root = expression.self();
+		if (!root.isValid() || root.size() == BROADCAST_SIZE) return std::vector<R>();
+
+		std::vector<R> result(root.size());
+		evaluate(expression, std::span<R>(result));
+		return result;
+	}
+}
+
+
+//*******************************
+
+#endif
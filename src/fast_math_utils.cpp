@@ -0,0 +1,65 @@
+#include <fast_math_utils.h>
+
+namespace Utils
+{
+#pragma region Batch
+
+	/**
+	 * @brief Batch fastAcos(). The loop has no call and can be vectorized.
+	 * @param[in] values Values
+	 * @param[out] result Result in radian. Its size must be the same as values. It can be the same buffer as values.
+	 * @return Return false if the sizes are not the same.
+	 * @date 2026-10-16
+	*/
+	bool fastAcos(std::span<const double> values, std::span<double> result)
+	{
+		if (values.size() != result.size()) return false;
+
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			result[i] = fastAcos(values[i]);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Batch fastRsqrt()
+	 * @param[in] values Values
+	 * @param[out] result Result. Its size must be the same as values. It can be the same buffer as values.
+	 * @return Return false if the sizes are not the same.
+	 * @date 2026-10-16
+	*/
+	bool fastRsqrt(std::span<const float> values, std::span<float> result)
+	{
+		if (values.size() != result.size()) return false;
+
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			result[i] = fastRsqrt(values[i]);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Batch fastRsqrt()
+	 * @param[in] values Values
+	 * @param[out] result Result. Its size must be the same as values. It can be the same buffer as values.
+	 * @return Return false if the sizes are not the same.
+	 * @date 2026-10-16
+	*/
+	bool fastRsqrt(std::span<const double> values, std::span<double> result)
+	{
+		if (values.size() != result.size()) return false;
+
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			result[i] = fastRsqrt(values[i]);
+		}
+
+		return true;
+	}
+
+#pragma endregion Batch
+}
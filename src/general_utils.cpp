@@ -4,36 +4,132 @@ namespace Utils
 {
 #pragma region String
 
+    namespace
+    {
+        /**
+         * @brief Call func(token) for every token of str split by any character of delimiter.
+         * Delimiters are looked up in a table of 256 flags, and a single delimiter is searched by memchr (string_view::find).
+         */
+        template <typename Func>
+        void forEachToken(std::string_view str, std::string_view delimiter, bool keepEmpty, Func func)
+        {
+            auto addToken = [&](size_t first, size_t last)
+            {
+                if (keepEmpty || last > first) func(str.substr(first, last - first));
+            };
+
+            size_t first = 0;
+            if (delimiter.size() == 1)
+            {
+                size_t position;
+                while ((position = str.find(delimiter[0], first)) != std::string_view::npos)
+                {
+                    addToken(first, position);
+                    first = position + 1;
+                }
+            }
+            else if (delimiter.size() > 1)
+            {
+                bool isDelimiter[256] = { false };
+                for (char c : delimiter)
+                {
+                    isDelimiter[(unsigned char)c] = true;
+                }
+
+                for (size_t i = 0; i < str.size(); i++)
+                {
+                    if (isDelimiter[(unsigned char)str[i]])
+                    {
+                        addToken(first, i);
+                        first = i + 1;
+                    }
+                }
+            }
+            addToken(first, str.size());
+        }
+    }
+
     /**
-     * @brief Split string by delimiter
+     * @brief Split string by any character of delimiter
+     * 
+     * @code{.cpp}
+     * std::vector<std::string> tokens = Utils::splitStr("a, b,,c", ", ");
+     * // tokens = { "a", "b", "c" }
      * 
-     * @param str String to be splitted
-     * @param delimiter Delimiter
+     * tokens = Utils::splitStr("a,,c,", ",", true);
+     * // tokens = { "a", "", "c", "" }
+     * @endcode
+     * 
+     * @param[in] str String to be splitted
+     * @param[in] delimiter Delimiter characters. Each character is a delimiter.
+     * @param[in] keepEmpty (Option) Keep the empty strings between adjacent delimiters. Default as false.
      * @return std::vector<std::string> Splitted strings
      * @date 2021-03-17
      */
-    std::vector<std::string> splitStr(std::string str, std::string delimiter)
+    std::vector<std::string> splitStr(std::string_view str, std::string_view delimiter, bool keepEmpty)
     {
-        std::regex re("[" + std::string(delimiter) + "]");
+        std::vector<std::string> tokens;
+        forEachToken(str, delimiter, keepEmpty, [&tokens](std::string_view token) { tokens.emplace_back(token); });
+        return tokens;
+    }
 
-        std::sregex_token_iterator it{ str.begin(), str.end(), re, -1 };
-        std::vector<std::string> tokenized{ it, {} };
+    /**
+     * @brief Split string by any character of delimiter without copying. The tokens point into str, so str must outlive them.
+     * The vector can be reused between calls to avoid allocation.
+     * 
+     * @code{.cpp}
+     * std::vector<std::string_view> tokens;
+     * std::string line;
+     * while (std::getline(file, line))
+     * {
+     *     Utils::splitStr(line, ",", &tokens, true);
+     *     ...
+     * }
+     * @endcode
+     * 
+     * @param[in] str String to be splitted
+     * @param[in] delimiter Delimiter characters. Each character is a delimiter.
+     * @param[out] tokens Splitted strings. It will be cleared first.
+     * @param[in] keepEmpty (Option) Keep the empty strings between adjacent delimiters. Default as false.
+     * @return Return the number of tokens.
+     * @date 2026-10-16
+     */
+    size_t splitStr(std::string_view str, std::string_view delimiter, std::vector<std::string_view>* tokens, bool keepEmpty)
+    {
+        tokens->clear();
+        forEachToken(str, delimiter, keepEmpty, [tokens](std::string_view token) { tokens->push_back(token); });
+        return tokens->size();
+    }
 
-        // Additional check to remove empty strings 
-        tokenized.erase(
-            std::remove_if(tokenized.begin(), tokenized.end(),
-                [](std::string const& s) {
-                    return s.size() == 0;
-                }
-            ),
-            tokenized.end()
-                    );
+    /**
+     * @brief Split string by any character of delimiter without copying. The tokens point into str, so str must outlive them.
+     * 
+     * @param[in] str String to be splitted
+     * @param[in] delimiter Delimiter characters. Each character is a delimiter.
+     * @param[in] keepEmpty (Option) Keep the empty strings between adjacent delimiters. Default as false.
+     * @return std::vector<std::string_view> Splitted strings
+     * @date 2026-10-16
+     */
+    std::vector<std::string_view> splitStrView(std::string_view str, std::string_view delimiter, bool keepEmpty)
+    {
+        std::vector<std::string_view> tokens;
+        splitStr(str, delimiter, &tokens, keepEmpty);
+        return tokens;
+    }
 
-        return tokenized;
+    namespace
+    {
+        /**
+         * @brief Maximum length of a double in fixed notation, i.e. sign, 309 integer digits, point and the decimals
+         */
+        size_t maxFixedLength(int precision)
+        {
+            return 311 + (size_t)(precision < 0 ? 6 : precision);
+        }
     }
 
     /**
-     * @brief Convert double in specific precision
+     * @brief Convert double in specific precision, same as std::fixed with std::setprecision but without stream.
      * @param value Value to be converted
      * @param precision Precision
      * @return Return string
@@ -41,9 +137,82 @@ namespace Utils
     */
     std::string to_string(double value, int precision)
     {
-        std::stringstream ss;
-        ss << std::fixed << std::setprecision(precision) << value;
-        return ss.str();
+        char buffer[128];
+        size_t length = formatDouble(value, precision, buffer, sizeof(buffer));
+        if (length > 0) return std::string(buffer, length);
+
+        // Large value or precision
+        std::string result(maxFixedLength(precision), '\0');
+        result.resize(formatDouble(value, precision, result.data(), result.size()));
+        return result;
+    }
+
+    /**
+     * @brief Write double in specific precision (fixed notation) into buffer by std::to_chars. Nothing is allocated.
+     * 
+     * @code{.cpp}
+     * char buffer[64];
+     * size_t length = Utils::formatDouble(3.14159, 2, buffer, sizeof(buffer));
+     * // std::string_view(buffer, length) = "3.14"
+     * @endcode
+     * 
+     * @param[in] value Value to be converted
+     * @param[in] precision Number of decimals. Negative precision is treated as 6.
+     * @param[out] buffer Output buffer. It is not null-terminated.
+     * @param[in] bufferSize Size of buffer
+     * @return Return the number of characters written. Return 0 if the buffer is too small.
+     * @date 2026-10-16
+     */
+    size_t formatDouble(double value, int precision, char* buffer, size_t bufferSize)
+    {
+        std::to_chars_result result = std::to_chars(buffer, buffer + bufferSize, value, std::chars_format::fixed, precision < 0 ? 6 : precision);
+        if (result.ec != std::errc()) return 0;
+        return result.ptr - buffer;
+    }
+
+    /**
+     * @brief Append values in specific precision (fixed notation) separated by separator into output.
+     * The output grows in large steps and values are written in place, so there is no allocation per value.
+     * 
+     * @code{.cpp}
+     * std::string line;
+     * line.reserve(values.size() * 12);
+     * Utils::formatDoubles(values, 3, &line, "\t");
+     * line += "\n";
+     * @endcode
+     * 
+     * @param[in] values Values to be converted
+     * @param[in] precision Number of decimals. Negative precision is treated as 6.
+     * @param[in, out] output Output string. Values are appended to it.
+     * @param[in] separator (Option) Separator between values. Default as ",".
+     * @return Return the number of characters appended.
+     * @date 2026-10-16
+     */
+    size_t formatDoubles(std::span<const double> values, int precision, std::string* output, std::string_view separator)
+    {
+        size_t start = output->size();
+        size_t position = start;
+        size_t maxLength = maxFixedLength(precision) + separator.size();
+
+        // Most values are much shorter than maxLength
+        size_t estimatedLength = values.size() * ((size_t)(precision < 0 ? 6 : precision) + 8 + separator.size());
+        output->resize(start + std::max(estimatedLength, maxLength));
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (output->size() - position < maxLength) output->resize(std::max(output->size() * 2, position + maxLength));
+
+            char* buffer = output->data();
+            if (i > 0)
+            {
+                std::copy(separator.begin(), separator.end(), buffer + position);
+                position += separator.size();
+            }
+            position += formatDouble(values[i], precision, buffer + position, output->size() - position);
+        }
+
+        output->resize(position);
+        return position - start;
     }
 
 #pragma endregion String
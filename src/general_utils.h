@@ -3,8 +3,12 @@
 #define JW_GENERAL_UTILS_H
 
 //************Content************
-#include <regex> 
 #include <string>
+#include <string_view>
+#include <span>
+#include <charconv>
+#include <algorithm>
+#include <type_traits>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -30,8 +34,12 @@ namespace Utils
 #endif
 
     // ******String******
-    std::vector<std::string> splitStr(std::string str, std::string delimiter);
+    std::vector<std::string> splitStr(std::string_view str, std::string_view delimiter, bool keepEmpty = false);
+    size_t splitStr(std::string_view str, std::string_view delimiter, std::vector<std::string_view>* tokens, bool keepEmpty = false);
+    std::vector<std::string_view> splitStrView(std::string_view str, std::string_view delimiter, bool keepEmpty = false);
     std::string to_string(double value, int precision);
+    size_t formatDouble(double value, int precision, char* buffer, size_t bufferSize);
+    size_t formatDoubles(std::span<const double> values, int precision, std::string* output, std::string_view separator = ",");
 
     // ******Time******
     std::string to_string(time_t time, std::string format = "%Y-%m-%d %H:%M:%S");
@@ -117,59 +125,71 @@ namespace Utils
     }
 
     /**
-	 * @brief Find the index of the closest value in the array
+	 * @brief Find the index of the closest value in the array. The sorted array is searched by binary search in O(log n),
+	 * otherwise all values are scanned once. Sort once by Utils::radixSort() or Utils::parallelSort() if many values are searched in the same array.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * Utils::radixSort(std::span<float>(values));
+	 * int index = Utils::findClosestIndex(3.2f, values, true);
+     * @endcode
+	 *
 	 * @tparam T Numerical variable
 	 * @param[in] value Value to search
 	 * @param[in] values The array
-	 * @param[in] sorted (option) Set as true if the array was sorted. Default as false.
-	 * @return Return the index of the closest value in the array. Return -1 if something wrong.
+	 * @param[in] sorted (option) Set as true if the array was sorted in ascending order. Default as false.
+	 * @return Return the index of the closest value in the array. The smaller index is returned if two values are equally close. Return -1 if something wrong, e.g. empty array.
      * @date 2021-04-09
 	*/
 	template<typename T>
-	int findClosestIndex(T value, std::vector<T> values, bool sorted = false)
+	int findClosestIndex(T value, const std::vector<T>& values, bool sorted = false)
 	{
 		// Exception
 		if constexpr (!is_numerical<T>)
 			throw "This funciton only support numerical type.";
 
-		int result = -1;
-		if (sorted)
+		if (values.empty()) return -1;
+
+		// Distance in T without overflow or truncation. NaN gives NaN, which is never closer.
+		auto distance = [value](T other)
 		{
-			int low = std::lower_bound(values.begin(), values.end(), value) - values.begin();
-			int distance1 = std::abs(values[low - 1] - value);
-			int distance2 = std::abs(values[low] - value);
-			int distance3 = std::abs(values[low + 1] - value);
-			if (distance1 < distance2 && distance1 < distance3)
-			{
-				result = low - 1;
-			}
-			else if (distance2 < distance1 && distance2 < distance3)
+			if constexpr (std::is_integral_v<T>)
 			{
-				result = low;
+				using U = std::make_unsigned_t<T>;
+				return other > value ? (U)((U)other - (U)value) : (U)((U)value - (U)other);
 			}
 			else
 			{
-				result = low + 1;
+				return other > value ? other - value : value - other;
 			}
+		};
+
+		if (sorted)
+		{
+			// The closest value is either the first value not less than value or the one before it.
+			// The one before it is moved to its first copy, so the smaller index is returned as the unsorted search does.
+			size_t low = std::lower_bound(values.begin(), values.end(), value) - values.begin();
+			if (low == 0) return 0;
+			if (low == values.size() || distance(values[low - 1]) <= distance(values[low]))
+				return (int)(std::lower_bound(values.begin(), values.begin() + low, values[low - 1]) - values.begin());
+			return (int)low;
 		}
 		else
 		{
-			int minDistance = std::abs(values[0] - value);
-			int minIndex = 0;
-			for (int i = 1; i < values.size(); i++)
+			int minIndex = -1;
+			auto minDistance = distance(values[0]);
+			for (size_t i = 0; i < values.size(); i++)
 			{
-				int distance = std::abs(values[i] - value);
-				if (distance < minDistance)
+				auto currentDistance = distance(values[i]);
+				if (currentDistance != currentDistance) continue;
+				if (minIndex < 0 || currentDistance < minDistance)
 				{
-					minIndex = i;
-					minDistance = distance;
+					minIndex = (int)i;
+					minDistance = currentDistance;
 				}
 			}
-
-			result = minIndex;
+			return minIndex;
 		}
-
-		return result;
 	}
 }
 
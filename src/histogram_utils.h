@@ -0,0 +1,266 @@
+#pragma once
+#ifndef JW_HISTOGRAM_UTILS_H
+#define JW_HISTOGRAM_UTILS_H
+
+//************Content************
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+#include <thread_utils.h>
+
+namespace Utils
+{
+	/**
+	 * @brief Check whether typename can be counted by Histogram, i.e. 8-bit or 16-bit unsigned integer
+	 * @tparam T Type to be checked.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	constexpr bool is_histogram_type = std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t>;
+
+	/**
+	 * @brief Counting histogram of 8-bit or 16-bit values with one bin per value. Values are counted in one linear pass,
+	 * and median or any quantile is found by scanning the bins, which is much faster than sorting large images.
+	 * Histograms of different parts can be merged, e.g. one histogram per thread.
+	 * Quantiles are interpolated in the same way as quantiles(), i.e. value at position q * (count - 1).
+	 *
+     * @code{.cpp}
+     * std::vector<uchar> r, g, b;
+	 * Utils::acquireRGB(image, &r, &g, &b);
+	 * Utils::Histogram<uint8_t> histogram(r);
+	 * uint8_t median = histogram.median();
+	 * std::vector<double> percentiles = histogram.quantiles({ 0.05, 0.95 });
+     * @endcode
+	 *
+	 * @tparam T uint8_t or uint16_t
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	class Histogram
+	{
+		static_assert(is_histogram_type<T>, "Histogram only support uint8_t and uint16_t.");
+
+		public:
+			static constexpr size_t BIN_COUNT = (size_t)1 << (8 * sizeof(T));
+
+			Histogram() : m_counts(BIN_COUNT, 0), m_count(0) {}
+
+			/**
+			 * @brief Construct a histogram of values
+			 * @param values Values to be counted
+			 * @param threadCount (Option) Number of threads. Default as 1.
+			*/
+			Histogram(std::span<const T> values, int threadCount = 1) : Histogram() { add(values, threadCount); }
+			Histogram(const std::vector<T>& values, int threadCount = 1) : Histogram() { add(std::span<const T>(values), threadCount); }
+
+			/**
+			 * @brief Count values. Large inputs are split into blocks counted on several threads and merged.
+			 * @param values Values to be counted
+			 * @param threadCount (Option) Number of threads. Default as 1.
+			*/
+			void add(std::span<const T> values, int threadCount = 1)
+			{
+				size_t taskCount = std::min((size_t)std::max(threadCount, 1), values.size() / PARALLEL_BLOCK_SIZE);
+				if (taskCount <= 1)
+				{
+					countValues(values.data(), values.size());
+					return;
+				}
+
+				// One histogram per task
+				std::vector<Histogram<T>> partials(taskCount);
+				size_t taskSize = (values.size() + taskCount - 1) / taskCount;
+				parallelFor(taskCount, [&](size_t task)
+					{
+						size_t first = task * taskSize;
+						size_t last = std::min(values.size(), first + taskSize);
+						partials[task].countValues(values.data() + first, last - first);
+					}, (int)taskCount
+				);
+
+				for (size_t i = 0; i < taskCount; i++)
+				{
+					merge(partials[i]);
+				}
+			}
+
+			void add(T value)
+			{
+				m_counts[value]++;
+				m_count++;
+			}
+
+			/**
+			 * @brief Add the counts of another histogram
+			 * @param other Histogram to be merged
+			*/
+			void merge(const Histogram<T>& other)
+			{
+				for (size_t i = 0; i < BIN_COUNT; i++)
+				{
+					m_counts[i] += other.m_counts[i];
+				}
+				m_count += other.m_count;
+			}
+
+			void reset()
+			{
+				std::fill(m_counts.begin(), m_counts.end(), 0);
+				m_count = 0;
+			}
+
+			uint64_t getCount() const { return m_count; }
+			std::span<const uint64_t> getCounts() const { return m_counts; }
+
+			/**
+			 * @brief Get the value at rank, i.e. the value at index rank after sorting
+			 * @param rank Rank in [0, getCount())
+			 * @return Return the value. Return 0 if rank is out of range.
+			*/
+			T valueAtRank(uint64_t rank) const
+			{
+				uint64_t cumulative = 0;
+				for (size_t i = 0; i < BIN_COUNT; i++)
+				{
+					cumulative += m_counts[i];
+					if (cumulative > rank) return static_cast<T>(i);
+				}
+				return 0;
+			}
+
+			/**
+			 * @brief Median. The mean of the two middle values is truncated as median() does for integers.
+			 * @return Return median. Return 0 if no value was counted.
+			*/
+			T median() const
+			{
+				if (m_count == 0) return 0;
+
+				T middle = valueAtRank(m_count / 2);
+				if (m_count % 2 == 0)
+				{
+					T lowerMiddle = valueAtRank(m_count / 2 - 1);
+					return (lowerMiddle + middle) / 2;
+				}
+				return middle;
+			}
+
+			/**
+			 * @brief Quantiles with linear interpolation between the closest ranks. All quantiles are found in one scan of the bins,
+			 * without a table of cumulative counts.
+			 * @param probabilities Probabilities in [0, 1].
+			 * @return Return quantiles in the order of probabilities. Return empty vector if no value was counted or any probability is out of range.
+			*/
+			std::vector<double> quantiles(const std::vector<double>& probabilities) const
+			{
+				if (m_count == 0) return std::vector<double>();
+				for (double probability : probabilities)
+				{
+					if (!(probability >= 0.0 && probability <= 1.0)) return std::vector<double>();
+				}
+
+				// Visit the probabilities in ascending order, so that their ranks are ascending too
+				std::vector<size_t> order(probabilities.size());
+				for (size_t i = 0; i < order.size(); i++)
+				{
+					order[i] = i;
+				}
+				std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return probabilities[a] < probabilities[b]; });
+
+				// Value at rank is the first bin which cumulative count is larger than rank. Ranks are ascending, so a cursor
+				// for the lower ranks and one for the upper ranks only move forward and the bins are scanned once.
+				struct Cursor
+				{
+					size_t bin;
+					uint64_t cumulative;
+				};
+				auto valueAt = [&](Cursor& cursor, uint64_t rank)
+				{
+					while (cursor.cumulative <= rank)
+					{
+						cursor.bin++;
+						cursor.cumulative += m_counts[cursor.bin];
+					}
+					return (double)cursor.bin;
+				};
+				Cursor lowerCursor = { 0, m_counts[0] };
+				Cursor upperCursor = lowerCursor;
+
+				std::vector<double> result(probabilities.size());
+				for (size_t i : order)
+				{
+					double position = probabilities[i] * (double)(m_count - 1);
+					uint64_t lower = static_cast<uint64_t>(position);
+					double fraction = position - (double)lower;
+					double lowerValue = valueAt(lowerCursor, lower);
+					result[i] = (lower + 1 < m_count && fraction > 0.0) ?
+						lowerValue + fraction * (valueAt(upperCursor, lower + 1) - lowerValue) :
+						lowerValue;
+				}
+				return result;
+			}
+
+			double quantile(double probability) const
+			{
+				std::vector<double> result = quantiles({ probability });
+				return result.empty() ? 0.0 : result[0];
+			}
+
+		private:
+			static constexpr size_t PARALLEL_BLOCK_SIZE = (size_t)1 << 20;
+
+			void countValues(const T* values, size_t size)
+			{
+				if constexpr (std::is_same_v<T, uint8_t>)
+				{
+					// Count into 4 sub-histograms so that repeated values do not wait for the previous increment of the same bin.
+					// Chunks keep the 32-bit counters from overflow.
+					const size_t CHUNK_SIZE = (size_t)1 << 30;
+					uint32_t counts[4][256];
+					for (size_t first = 0; first < size; first += CHUNK_SIZE)
+					{
+						size_t last = std::min(size, first + CHUNK_SIZE);
+						std::fill(&counts[0][0], &counts[0][0] + 4 * 256, 0);
+
+						size_t i = first;
+						for (; i + 4 <= last; i += 4)
+						{
+							counts[0][values[i]]++;
+							counts[1][values[i + 1]]++;
+							counts[2][values[i + 2]]++;
+							counts[3][values[i + 3]]++;
+						}
+						for (; i < last; i++)
+						{
+							counts[0][values[i]]++;
+						}
+
+						for (size_t bin = 0; bin < 256; bin++)
+						{
+							m_counts[bin] += (uint64_t)counts[0][bin] + counts[1][bin] + counts[2][bin] + counts[3][bin];
+						}
+					}
+				}
+				else
+				{
+					// Bins are too many to be duplicated in cache, and repeated values are less likely.
+					uint64_t* counts = m_counts.data();
+					for (size_t i = 0; i < size; i++)
+					{
+						counts[values[i]]++;
+					}
+				}
+				m_count += size;
+			}
+
+			std::vector<uint64_t> m_counts;
+			uint64_t m_count;
+	};
+}
+
+
+//*******************************
+
+#endif
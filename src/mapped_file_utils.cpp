@@ -0,0 +1,142 @@
+#include "mapped_file_utils.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Utils
+{
+#pragma region MappedFile
+
+	MappedFile::MappedFile() : m_data(NULL), m_size(0), m_isOpen(false) {}
+
+	/**
+	 * @brief Construct and map the file. Check isOpen() for the result.
+	 * @param path File path
+	*/
+	MappedFile::MappedFile(const std::string& path) : MappedFile()
+	{
+		open(path);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept : m_data(other.m_data), m_size(other.m_size), m_isOpen(other.m_isOpen)
+	{
+		other.m_data = NULL;
+		other.m_size = 0;
+		other.m_isOpen = false;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			m_data = other.m_data;
+			m_size = other.m_size;
+			m_isOpen = other.m_isOpen;
+			other.m_data = NULL;
+			other.m_size = 0;
+			other.m_isOpen = false;
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Map the whole file as read-only. The previous file will be closed. An empty file is opened with data() as NULL.
+	 * The OS is advised that the file will be read sequentially, so pages which were read can be dropped from memory early.
+	 * @param path File path
+	 * @return Return false if the file cannot be opened or mapped.
+	 * @date 2026-10-16
+	*/
+	bool MappedFile::open(const std::string& path)
+	{
+		close();
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		if (fileSize.QuadPart > 0)
+		{
+			// The view keeps the mapping alive, so the handles can be closed
+			HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			void* data = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+			if (mapping != NULL) CloseHandle(mapping);
+			if (data == NULL)
+			{
+				CloseHandle(file);
+				return false;
+			}
+			m_data = (const char*)data;
+			m_size = (size_t)fileSize.QuadPart;
+		}
+		CloseHandle(file);
+#else
+		int file = ::open(path.c_str(), O_RDONLY);
+		if (file < 0) return false;
+
+		struct stat fileStat;
+		if (fstat(file, &fileStat) != 0)
+		{
+			::close(file);
+			return false;
+		}
+
+		if (fileStat.st_size > 0)
+		{
+			// The mapping is kept after the file is closed
+			void* data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+			if (data == MAP_FAILED)
+			{
+				::close(file);
+				return false;
+			}
+			madvise(data, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+			m_data = (const char*)data;
+			m_size = (size_t)fileStat.st_size;
+		}
+		::close(file);
+#endif
+
+		m_isOpen = true;
+		return true;
+	}
+
+	/**
+	 * @brief Unmap the file. Views and ranges of the file become invalid.
+	 * @date 2026-10-16
+	*/
+	void MappedFile::close()
+	{
+		if (m_data != NULL)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(m_data);
+#else
+			munmap((void*)m_data, m_size);
+#endif
+		}
+		m_data = NULL;
+		m_size = 0;
+		m_isOpen = false;
+	}
+
+#pragma endregion MappedFile
+}
@@ -0,0 +1,267 @@
+#pragma once
+#ifndef JW_MAPPED_FILE_UTILS_H
+#define JW_MAPPED_FILE_UTILS_H
+
+//************Content************
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <cstring>
+#include <cstddef>
+
+namespace Utils
+{
+	class LineRange;
+
+	/**
+	 * @brief Read-only memory-mapped file. The whole file is mapped into the address space and pages are loaded by the OS on access,
+	 * so multi-GB files can be read without copying them into memory. The mapping is released when the object is destroyed.
+	 * Use it with LineRange and TokenRange to stream a file without allocation.
+	 *
+     * @code{.cpp}
+     * Utils::MappedFile file("D:/log.txt");
+	 * if (!file.isOpen()) return;
+	 * for (std::string_view line : file.lines())
+	 * {
+	 *     for (std::string_view token : Utils::TokenRange(line, ",; "))
+	 *     {
+	 *         ...
+	 *     }
+	 * }
+     * @endcode
+     * @date 2026-10-16
+	*/
+	class MappedFile
+	{
+		public:
+			MappedFile();
+			MappedFile(const std::string& path);
+			~MappedFile();
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile(MappedFile&& other) noexcept;
+			MappedFile& operator=(MappedFile&& other) noexcept;
+
+			bool open(const std::string& path);
+			void close();
+
+			bool isOpen() const { return m_isOpen; }
+			const char* data() const { return m_data; }
+			size_t size() const { return m_size; }
+			std::string_view view() const { return std::string_view(m_data, m_size); }
+			LineRange lines() const;
+
+		private:
+			const char* m_data;
+			size_t m_size;
+			bool m_isOpen;
+	};
+
+	/**
+	 * @brief Lazy range of the lines of a text. Lines are split by '\n' and a trailing '\r' is removed. The last line is yielded
+	 * even if it does not end with '\n', but no empty line is yielded after the last '\n' (same as std::getline).
+	 * Lines are std::string_view into the text, so the text must outlive them. Each line is found by memchr when the iterator is incremented.
+	 *
+     * @code{.cpp}
+     * std::string_view text = "a,b\r\nc\n";
+	 * Utils::LineRange lines(text);
+	 * for (std::string_view line : lines)
+	 * {
+	 *     // "a,b", "c"
+	 * }
+	 * size_t lineCount = std::distance(lines.begin(), lines.end());
+     * @endcode
+     * @date 2026-10-16
+	*/
+	class LineRange
+	{
+		public:
+			class Iterator
+			{
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = std::string_view;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const std::string_view*;
+					using reference = const std::string_view&;
+
+					Iterator() : m_position(NULL), m_next(NULL), m_end(NULL) {}
+					Iterator(const char* first, const char* last) : m_position(first), m_next(NULL), m_end(last)
+					{
+						if (m_position == m_end) m_position = NULL;
+						else findLine();
+					}
+
+					reference operator*() const { return m_line; }
+					pointer operator->() const { return &m_line; }
+
+					Iterator& operator++()
+					{
+						m_position = m_next;
+						if (m_position == m_end) m_position = NULL;
+						else findLine();
+						return *this;
+					}
+
+					Iterator operator++(int)
+					{
+						Iterator previous = *this;
+						++*this;
+						return previous;
+					}
+
+					bool operator==(const Iterator& other) const { return m_position == other.m_position; }
+					bool operator!=(const Iterator& other) const { return m_position != other.m_position; }
+
+				private:
+					void findLine()
+					{
+						const char* newLine = (const char*)std::memchr(m_position, '\n', m_end - m_position);
+						const char* lineEnd = newLine != NULL ? newLine : m_end;
+						m_next = newLine != NULL ? newLine + 1 : m_end;
+						if (lineEnd > m_position && lineEnd[-1] == '\r') lineEnd--;
+						m_line = std::string_view(m_position, lineEnd - m_position);
+					}
+
+					const char* m_position; // Start of the current line, NULL at the end
+					const char* m_next;
+					const char* m_end;
+					std::string_view m_line;
+			};
+
+			LineRange(std::string_view text) : m_text(text) {}
+
+			Iterator begin() const { return Iterator(m_text.data(), m_text.data() + m_text.size()); }
+			Iterator end() const { return Iterator(); }
+
+		private:
+			std::string_view m_text;
+	};
+
+	/**
+	 * @brief Lazy range of the tokens of a string split by any character of delimiter, same as splitStr() but without any allocation.
+	 * Tokens are std::string_view into the string, so the string must outlive them, and iterators must not outlive the range.
+	 *
+     * @code{.cpp}
+     * for (std::string_view token : Utils::TokenRange("a, b,,c", ", "))
+	 * {
+	 *     // "a", "b", "c"
+	 * }
+	 * // With empty tokens: "a", "", "c", ""
+	 * Utils::TokenRange tokens("a,,c,", ",", true);
+	 * std::vector<std::string_view> fields(tokens.begin(), tokens.end());
+     * @endcode
+     * @date 2026-10-16
+	*/
+	class TokenRange
+	{
+		public:
+			class Iterator
+			{
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = std::string_view;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const std::string_view*;
+					using reference = const std::string_view&;
+
+					Iterator() : m_range(NULL), m_position(std::string_view::npos), m_next(std::string_view::npos) {}
+					Iterator(const TokenRange* range) : m_range(range), m_position(0), m_next(std::string_view::npos) { findToken(); }
+
+					reference operator*() const { return m_token; }
+					pointer operator->() const { return &m_token; }
+
+					Iterator& operator++()
+					{
+						m_position = m_next;
+						findToken();
+						return *this;
+					}
+
+					Iterator operator++(int)
+					{
+						Iterator previous = *this;
+						++*this;
+						return previous;
+					}
+
+					bool operator==(const Iterator& other) const { return m_position == other.m_position; }
+					bool operator!=(const Iterator& other) const { return m_position != other.m_position; }
+
+				private:
+					/**
+					 * @brief Find the token starting at m_position. Empty tokens are skipped unless keepEmpty.
+					*/
+					void findToken()
+					{
+						const std::string_view& str = m_range->m_str;
+						while (m_position != std::string_view::npos)
+						{
+							size_t delimiter = m_range->findDelimiter(m_position);
+							size_t tokenEnd = delimiter != std::string_view::npos ? delimiter : str.size();
+							m_next = delimiter != std::string_view::npos ? delimiter + 1 : std::string_view::npos;
+							if (m_range->m_keepEmpty || tokenEnd > m_position)
+							{
+								m_token = str.substr(m_position, tokenEnd - m_position);
+								return;
+							}
+							m_position = m_next;
+						}
+					}
+
+					const TokenRange* m_range;
+					size_t m_position; // Start of the current token, npos at the end
+					size_t m_next; // Start of the next token, npos if the current token is the last one
+					std::string_view m_token;
+			};
+
+			/**
+			 * @brief Construct a range of tokens
+			 * @param str String to be splitted
+			 * @param delimiter Delimiter characters. Each character is a delimiter.
+			 * @param keepEmpty (Option) Keep the empty strings between adjacent delimiters. Default as false.
+			*/
+			TokenRange(std::string_view str, std::string_view delimiter, bool keepEmpty = false) :
+				m_str(str), m_delimiterCount(delimiter.size()), m_firstDelimiter(delimiter.empty() ? '\0' : delimiter[0]), m_keepEmpty(keepEmpty), m_isDelimiter{ false }
+			{
+				for (char c : delimiter)
+				{
+					m_isDelimiter[(unsigned char)c] = true;
+				}
+			}
+
+			Iterator begin() const { return Iterator(this); }
+			Iterator end() const { return Iterator(); }
+
+		private:
+			/**
+			 * @brief Find the first delimiter at or after position. A single delimiter is searched by memchr, otherwise by the table of flags.
+			 * @return Return npos if not found.
+			*/
+			size_t findDelimiter(size_t position) const
+			{
+				if (m_delimiterCount == 1) return m_str.find(m_firstDelimiter, position);
+				if (m_delimiterCount == 0) return std::string_view::npos;
+
+				for (size_t i = position; i < m_str.size(); i++)
+				{
+					if (m_isDelimiter[(unsigned char)m_str[i]]) return i;
+				}
+				return std::string_view::npos;
+			}
+
+			std::string_view m_str;
+			size_t m_delimiterCount;
+			char m_firstDelimiter;
+			bool m_keepEmpty;
+			bool m_isDelimiter[256];
+	};
+
+	inline LineRange MappedFile::lines() const { return LineRange(view()); }
+}
+
+
+//*******************************
+
+#endif
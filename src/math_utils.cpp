@@ -3,25 +3,42 @@
 namespace Utils
 {
 	/**
-	 * @brief Convert radius to degree
-	 * @param radius Radius value
-	 * @return Return degree value
-     * @date 2021-03-17
+	 * @brief Convert radius to degree in batch
+	 * @param[in] radius Radius values
+	 * @param[out] degree Degree values. Its size must be the same as radius. It can be the same buffer as radius.
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
 	*/
-	double toDegree(double radius)
+	bool toDegree(std::span<const double> radius, std::span<double> degree)
 	{
-		return radius * 180.0 / PI;
+		if (radius.size() != degree.size()) return false;
+
+		const double scale = 180.0 / PI;
+		for (size_t i = 0; i < radius.size(); i++)
+		{
+			degree[i] = radius[i] * scale;
+		}
+
+		return true;
 	}
 
 	/**
-	 * @brief Convert degree to radius
-	 * 
-	 * @param degree Degree value
-	 * @return Return radius value
-     * @date 2021-03-17
-	 */
-	double toRadius(double degree)
+	 * @brief Convert degree to radius in batch
+	 * @param[in] degree Degree values
+	 * @param[out] radius Radius values. Its size must be the same as degree. It can be the same buffer as degree.
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	bool toRadius(std::span<const double> degree, std::span<double> radius)
 	{
-		return degree * PI / 180.0;
+		if (degree.size() != radius.size()) return false;
+
+		const double scale = PI / 180.0;
+		for (size_t i = 0; i < degree.size(); i++)
+		{
+			radius[i] = degree[i] * scale;
+		}
+
+		return true;
 	}
-}
\ No newline at end of file
+}
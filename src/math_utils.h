@@ -4,7 +4,17 @@
 
 //************Content************
 #include <vector>
+#include <span>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
 #include <math.h>
+#include <thread_utils.h>
+#include <simd_utils.h>
+#include <expression_utils.h>
+#include <bitmask_utils.h>
+#include <histogram_utils.h>
+#include <sort_utils.h>
 
 constexpr double PI = 3.1415926535897932384626433;
 namespace Utils
@@ -22,123 +32,2327 @@ namespace Utils
 #endif
 
 	/**
-	 * @brief Average
+	 * @brief Descriptive statistics of a set of values. See describe().
+     * @date 2026-10-16
+	*/
+	struct Statistics
+	{
+		size_t count = 0;
+		double sum = 0.0;
+		double mean = 0.0;
+		double variance = 0.0; // Sample variance, divided by (count - 1)
+		double stdev = 0.0;
+		double min = 0.0;
+		double max = 0.0;
+	};
+
+	/**
+	 * @brief Statistics of two paired series x and y, which is the result of describePair()
+	 * @date 2026-10-16
+	*/
+	struct PairStatistics
+	{
+		size_t count = 0;
+		double meanX = 0.0;
+		double meanY = 0.0;
+		double varianceX = 0.0; // Sample variance, divided by (count - 1)
+		double varianceY = 0.0;
+		double covariance = 0.0; // Sample covariance, divided by (count - 1)
+		double correlation = 0.0; // Pearson correlation coefficient
+		double slope = 0.0; // Least squares line y = slope * x + intercept
+		double intercept = 0.0;
+	};
+
+	/**
+	 * @brief Accumulation precision policies of the reductions, e.g. average(), stdev() and describe().
+	 * They are passed as the last argument and only change how floating point values are summed. Integer sums stay exact.
+	 * Costs of float data measured with GCC -O2 on x86-64, single thread, relative to DoubleAccumulation:
+	 * @li FloatAccumulation: Sum in float blocks flushed into double. 1.6x to 1.9x faster for 16M values (memory bound)
+	 * and 1.7x to 6x faster for 16K values (in cache). Relative error was about 1e-8, and it is bounded by about 1e-7 * log2(n).
+	 * @li DoubleAccumulation: Sum in double. The default. Relative error was about 1e-16.
+	 * @li CompensatedAccumulation: Compensated sum in double. Error does not grow with n. 1.5x to 2x slower for 16M values
+	 * and about 3x slower for 16K values.
+	 * Compensation is removed by -ffast-math or /fp:fast, so it must not be used with these flags.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * float result = Utils::average<float>(values, 1, Utils::FloatAccumulation());
+	 * Utils::Statistics stats = Utils::describe(values, Utils::CompensatedAccumulation());
+     * @endcode
+     * @date 2026-10-16
+	*/
+	struct FloatAccumulation {};
+	struct DoubleAccumulation {};
+	struct CompensatedAccumulation {};
+
+	/**
+	 * @brief Check whether typename is an accumulation precision policy
+	 * @tparam T Type to be checked.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	constexpr bool is_accumulation_policy = std::is_same_v<T, FloatAccumulation> || std::is_same_v<T, DoubleAccumulation> ||
+		std::is_same_v<T, CompensatedAccumulation>;
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Type of the accumulators of the policy
+		*/
+		template <typename Policy>
+		using Accumulator = std::conditional_t<std::is_same_v<Policy, FloatAccumulation>, float, double>;
+
+		/**
+		 * @brief Compensated addition. The rounding error of sum + value is found exactly by TwoSum and collected in compensation,
+		 * and the compensated sum is sum + compensation. It has the accuracy of Neumaier summation without branches, so it can be vectorized.
+		 * @date 2026-10-16
+		*/
+		template <typename A>
+		inline void compensatedAdd(A& sum, A& compensation, A value)
+		{
+			A total = sum + value;
+			A valuePart = total - sum;
+			compensation += (sum - (total - valuePart)) + (value - valuePart);
+			sum = total;
+		}
+
+		/**
+		 * @brief Run accumulate(lane, i) for every i in [first, last) on four independent lanes, so that the loop can be vectorized.
+		 * The lanes sum the values in a different order from a sequential loop, so the floating point result may differ from it in the last bits.
+		 * @tparam Accumulate void(int lane, size_t index)
+		 * @date 2026-10-17
+		*/
+		template <typename Accumulate>
+		inline void forEachLane(size_t first, size_t last, Accumulate accumulate)
+		{
+			// The bound is computed once, which also avoids a false -Waggressive-loop-optimizations warning for constant sizes
+			size_t vectorEnd = first + (last - first) / 4 * 4;
+			size_t i = first;
+			for (; i < vectorEnd; i += 4)
+			{
+				for (int lane = 0; lane < 4; lane++)
+				{
+					accumulate(lane, i + lane);
+				}
+			}
+			for (; i < last; i++)
+			{
+				accumulate(0, i);
+			}
+		}
+
+		/**
+		 * @brief Sum the four lanes of forEachLane() in double
+		 * @date 2026-10-17
+		*/
+		template <typename A>
+		inline double combineLanes(const A* lanes)
+		{
+			return ((double)lanes[0] + lanes[1]) + ((double)lanes[2] + lanes[3]);
+		}
+	}
+
+	/**
+	 * @brief Calculate count, sum, mean, variance, stdev, min and max in a single pass without copying the values.
+	 * Values are shifted by the first element before being squared, so the variance does not suffer from
+	 * the cancellation of the naive sum of squares formula.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * Utils::Statistics stats = Utils::describe(values.begin(), values.end());
+     * @endcode
+	 *
+	 * @tparam Iterator Random access iterator of numerical type.
+	 * @tparam Policy (Option) Accumulation precision policy, passed as a tag argument. Default as DoubleAccumulation. See FloatAccumulation.
+	 * @param[in] first Begin of the values
+	 * @param[in] last End of the values
+	 * @return Return the statistics. All fields are 0 if the range is empty.
+     * @date 2026-10-16
+	*/
+	template <typename Iterator, typename Policy = DoubleAccumulation>
+	Statistics describe(Iterator first, Iterator last, Policy = Policy())
+	{
+		using T = typename std::iterator_traits<Iterator>::value_type;
+		using A = Detail::Accumulator<Policy>;
+		static_assert(is_accumulation_policy<Policy>, "Policy must be FloatAccumulation, DoubleAccumulation or CompensatedAccumulation.");
+
+		// Exception
+		if constexpr (!is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		Statistics result;
+		size_t size = static_cast<size_t>(last - first);
+		if (size == 0) return result;
+
+		// Four independent lanes, see Detail::forEachLane(). Lanes are flushed into double every block, so the error of float lanes does not grow with size.
+		const size_t BLOCK_SIZE = 1024;
+		const A shift = static_cast<A>(first[0]);
+		double shiftedSum = 0.0;
+		double shiftedSumSquare = 0.0;
+		double sumCompensation = 0.0;
+		double sumSquareCompensation = 0.0;
+		T min[4] = { first[0], first[0], first[0], first[0] };
+		T max[4] = { first[0], first[0], first[0], first[0] };
+
+		for (size_t blockBegin = 0; blockBegin < size; blockBegin += BLOCK_SIZE)
+		{
+			size_t blockEnd = std::min(size, blockBegin + BLOCK_SIZE);
+			A sum[4] = { 0, 0, 0, 0 };
+			A sumSquare[4] = { 0, 0, 0, 0 };
+			A compensation[4] = { 0, 0, 0, 0 };
+			A squareCompensation[4] = { 0, 0, 0, 0 };
+
+			auto accumulate = [&](int lane, size_t i)
+			{
+				T value = first[i];
+				A diff = static_cast<A>(value) - shift;
+				if constexpr (std::is_same_v<Policy, CompensatedAccumulation>)
+				{
+					Detail::compensatedAdd(sum[lane], compensation[lane], diff);
+					Detail::compensatedAdd(sumSquare[lane], squareCompensation[lane], diff * diff);
+				}
+				else
+				{
+					sum[lane] += diff;
+					sumSquare[lane] += diff * diff;
+				}
+				min[lane] = value < min[lane] ? value : min[lane];
+				max[lane] = value > max[lane] ? value : max[lane];
+			};
+
+			Detail::forEachLane(blockBegin, blockEnd, accumulate);
+
+			// Combine lanes of the block
+			double blockSum = Detail::combineLanes(sum);
+			double blockSumSquare = Detail::combineLanes(sumSquare);
+			if constexpr (std::is_same_v<Policy, CompensatedAccumulation>)
+			{
+				sumCompensation += Detail::combineLanes(compensation);
+				sumSquareCompensation += Detail::combineLanes(squareCompensation);
+				Detail::compensatedAdd(shiftedSum, sumCompensation, blockSum);
+				Detail::compensatedAdd(shiftedSumSquare, sumSquareCompensation, blockSumSquare);
+			}
+			else
+			{
+				shiftedSum += blockSum;
+				shiftedSumSquare += blockSumSquare;
+			}
+		}
+		shiftedSum += sumCompensation;
+		shiftedSumSquare += sumSquareCompensation;
+
+		// Combine lanes
+		T minValue = std::min(std::min(min[0], min[1]), std::min(min[2], min[3]));
+		T maxValue = std::max(std::max(max[0], max[1]), std::max(max[2], max[3]));
+
+		result.count = size;
+		result.sum = shiftedSum + (double)shift * (double)size;
+		result.mean = (double)shift + shiftedSum / (double)size;
+		if (size > 1)
+		{
+			double m2 = shiftedSumSquare - shiftedSum * shiftedSum / (double)size;
+			result.variance = (m2 > 0.0 ? m2 : 0.0) / (double)(size - 1);
+		}
+		result.stdev = std::sqrt(result.variance);
+		result.min = static_cast<double>(minValue);
+		result.max = static_cast<double>(maxValue);
+
+		return result;
+	}
+
+	/**
+	 * @brief Calculate count, sum, mean, variance, stdev, min and max in a single pass without copying the values.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * std::span<const float> window(values.data() + 100, 50);
+	 * Utils::Statistics stats = Utils::describe(window);
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @tparam Policy (Option) Accumulation precision policy, passed as a tag argument. Default as DoubleAccumulation.
+	 * @param[in] values Values to be described.
+	 * @return Return the statistics. All fields are 0 if values is empty.
+     * @date 2026-10-16
+	*/
+	template <typename T, typename Policy = DoubleAccumulation>
+	Statistics describe(std::span<const T> values, Policy = Policy())
+	{
+		return describe(values.data(), values.data() + values.size(), Policy());
+	}
+
+	/**
+	 * @brief Calculate count, sum, mean, variance, stdev, min and max in a single pass without copying the values.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * Utils::Statistics stats = Utils::describe(values);
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @tparam Policy (Option) Accumulation precision policy, passed as a tag argument. Default as DoubleAccumulation.
+	 * @param[in] values Values to be described.
+	 * @return Return the statistics. All fields are 0 if values is empty.
+     * @date 2026-10-16
+	*/
+	template <typename T, typename Policy = DoubleAccumulation>
+	Statistics describe(const std::vector<T>& values, Policy = Policy())
+	{
+		return describe(values.data(), values.data() + values.size(), Policy());
+	}
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Fill PairStatistics from the sums of squared and multiplied differences from the means
+		 * @param count Number of pairs
+		 * @param meanX Mean of x
+		 * @param meanY Mean of y
+		 * @param m2X Sum of (x - meanX)^2
+		 * @param m2Y Sum of (y - meanY)^2
+		 * @param cXY Sum of (x - meanX) * (y - meanY)
+		 * @return Return the statistics. Correlation and slope are 0 if the variance is 0.
+		 * @date 2026-10-16
+		*/
+		inline PairStatistics makePairStatistics(size_t count, double meanX, double meanY, double m2X, double m2Y, double cXY)
+		{
+			PairStatistics result;
+			result.count = count;
+			if (count == 0) return result;
+
+			result.meanX = meanX;
+			result.meanY = meanY;
+			m2X = m2X > 0.0 ? m2X : 0.0;
+			m2Y = m2Y > 0.0 ? m2Y : 0.0;
+			if (count > 1)
+			{
+				result.varianceX = m2X / (double)(count - 1);
+				result.varianceY = m2Y / (double)(count - 1);
+				result.covariance = cXY / (double)(count - 1);
+			}
+			if (m2X > 0.0 && m2Y > 0.0) result.correlation = std::max(-1.0, std::min(1.0, cXY / std::sqrt(m2X * m2Y)));
+			if (m2X > 0.0) result.slope = cXY / m2X;
+			result.intercept = meanY - result.slope * meanX;
+			return result;
+		}
+	}
+
+	/**
+	 * @brief Calculate means, variances, covariance, Pearson correlation and least squares line of two paired series in a single pass.
+	 * Both series are shifted by their first elements, so the result does not suffer from the cancellation of the naive formulas.
+	 *
+     * @code{.cpp}
+     * std::vector<float> x, y;
+	 * Utils::PairStatistics stats = Utils::describePair<float, float>(x, y);
+	 * double r = stats.correlation;
+     * @endcode
+	 *
+	 * @tparam T1 Numerical type of x.
+	 * @tparam T2 Numerical type of y.
+	 * @param[in] x Series x
+	 * @param[in] y Series y
+	 * @return Return the statistics. All fields are 0 if the series are empty or the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename T1, typename T2>
+	PairStatistics describePair(std::span<const T1> x, std::span<const T2> y)
+	{
+		// Exception
+		if constexpr (!is_numerical<T1> || !is_numerical<T2>)
+			throw "This funciton only support numerical type.";
+
+		size_t size = x.size();
+		if (size == 0 || size != y.size()) return PairStatistics();
+
+		// Four independent lanes, see Detail::forEachLane()
+		const double shiftX = static_cast<double>(x[0]);
+		const double shiftY = static_cast<double>(y[0]);
+		double sumX[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double sumY[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double sumXX[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double sumYY[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double sumXY[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+		auto accumulate = [&](int lane, size_t i)
+		{
+			double diffX = static_cast<double>(x[i]) - shiftX;
+			double diffY = static_cast<double>(y[i]) - shiftY;
+			sumX[lane] += diffX;
+			sumY[lane] += diffY;
+			sumXX[lane] += diffX * diffX;
+			sumYY[lane] += diffY * diffY;
+			sumXY[lane] += diffX * diffY;
+		};
+
+		Detail::forEachLane(0, size, accumulate);
+
+		// Combine lanes
+		double shiftedSumX = Detail::combineLanes(sumX);
+		double shiftedSumY = Detail::combineLanes(sumY);
+		double count = (double)size;
+
+		return Detail::makePairStatistics(size,
+			shiftX + shiftedSumX / count,
+			shiftY + shiftedSumY / count,
+			Detail::combineLanes(sumXX) - shiftedSumX * shiftedSumX / count,
+			Detail::combineLanes(sumYY) - shiftedSumY * shiftedSumY / count,
+			Detail::combineLanes(sumXY) - shiftedSumX * shiftedSumY / count);
+	}
+
+	/**
+	 * @brief Calculate means, variances, covariance, Pearson correlation and least squares line of two paired series in a single pass.
+	 * See describePair(std::span<const T1>, std::span<const T2>).
+	 *
+     * @code{.cpp}
+     * std::vector<int> x, y;
+	 * Utils::PairStatistics stats = Utils::describePair(x, y);
+     * @endcode
+	 *
+	 * @tparam T1 Numerical type of x.
+	 * @tparam T2 Numerical type of y.
+	 * @param[in] x Series x
+	 * @param[in] y Series y
+	 * @return Return the statistics. All fields are 0 if the series are empty or the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename T1, typename T2>
+	PairStatistics describePair(const std::vector<T1>& x, const std::vector<T2>& y)
+	{
+		return describePair(std::span<const T1>(x), std::span<const T2>(y));
+	}
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Number of values reduced by one task of the parallel reductions. The blocks never depend on the thread count.
+		*/
+		constexpr size_t REDUCTION_BLOCK_SIZE = 1 << 16;
+
+		/**
+		 * @brief Pairwise summation of transform(values[i]). The error grows with O(log n) instead of O(n) of a plain loop.
+		 * @tparam A Accumulator type
+		 * @tparam T Input type
+		 * @tparam Transform A(T)
+		 * @param values Values to be summed
+		 * @param size Number of values
+		 * @param transform Function applied on each value before summation
+		 * @return Return the sum
+		 * @date 2026-10-16
+		*/
+		template <typename A, typename T, typename Transform>
+		A pairwiseSum(const T* values, size_t size, Transform transform)
+		{
+			if (size <= 128)
+			{
+				// Eight lanes so that the base case can be vectorized
+				A lanes[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+				size_t i = 0;
+				for (; i + 8 <= size; i += 8)
+				{
+					for (int lane = 0; lane < 8; lane++)
+					{
+						lanes[lane] += static_cast<A>(transform(values[i + lane]));
+					}
+				}
+				for (; i < size; i++)
+				{
+					lanes[i % 8] += static_cast<A>(transform(values[i]));
+				}
+
+				return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+			}
+
+			size_t half = size / 2;
+			return pairwiseSum<A>(values, half, transform) + pairwiseSum<A>(values + half, size - half, transform);
+		}
+
+		/**
+		 * @brief Neumaier compensated summation of transform(values[i]) in eight lanes
+		 * @tparam T Input type
+		 * @tparam Transform double(T)
+		 * @param values Values to be summed
+		 * @param size Number of values
+		 * @param transform Function applied on each value before summation
+		 * @return Return the sum
+		 * @date 2026-10-16
+		*/
+		template <typename T, typename Transform>
+		double compensatedSum(const T* values, size_t size, Transform transform)
+		{
+			double lanes[8] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+			double compensations[8] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+			size_t i = 0;
+			for (; i + 8 <= size; i += 8)
+			{
+				for (int lane = 0; lane < 8; lane++)
+				{
+					compensatedAdd(lanes[lane], compensations[lane], static_cast<double>(transform(values[i + lane])));
+				}
+			}
+			for (; i < size; i++)
+			{
+				compensatedAdd(lanes[0], compensations[0], static_cast<double>(transform(values[i])));
+			}
+
+			double sum = 0.0;
+			double compensation = 0.0;
+			for (int lane = 0; lane < 8; lane++)
+			{
+				compensatedAdd(sum, compensation, lanes[lane]);
+				compensation += compensations[lane];
+			}
+			return sum + compensation;
+		}
+
+		/**
+		 * @brief Sum transform(values[i]) with the accumulation precision policy
+		 * @date 2026-10-16
+		*/
+		template <typename Policy, typename T, typename Transform>
+		double blockSum(const T* values, size_t size, Transform transform)
+		{
+			if constexpr (std::is_same_v<Policy, CompensatedAccumulation>) return compensatedSum(values, size, transform);
+			else return static_cast<double>(pairwiseSum<Accumulator<Policy>>(values, size, transform));
+		}
+
+		/**
+		 * @brief Sum transform(values[i]) by blocks of REDUCTION_BLOCK_SIZE on several threads.
+		 * The block partial sums are combined in block order, so the result is bit-identical for any thread count.
+		 * @tparam Policy Accumulation precision policy
+		 * @tparam T Input type
+		 * @tparam Transform Accumulator<Policy>(T)
+		 * @param values Values to be summed
+		 * @param size Number of values
+		 * @param transform Function applied on each value before summation
+		 * @param threadCount Number of threads. 0 to use all hardware threads.
+		 * @return Return the sum
+		 * @date 2026-10-16
+		*/
+		template <typename Policy = DoubleAccumulation, typename T, typename Transform>
+		double parallelSum(const T* values, size_t size, Transform transform, int threadCount)
+		{
+			size_t blockCount = (size + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+			if (blockCount <= 1) return blockSum<Policy>(values, size, transform);
+
+			std::vector<double> partialSums(blockCount);
+			parallelFor(blockCount, [&](size_t block)
+				{
+					size_t begin = block * REDUCTION_BLOCK_SIZE;
+					partialSums[block] = blockSum<Policy>(values + begin, std::min(REDUCTION_BLOCK_SIZE, size - begin), transform);
+				},
+				threadCount
+			);
+
+			// Partial sums are always combined in double
+			auto identity = [](double value) { return value; };
+			if constexpr (std::is_same_v<Policy, CompensatedAccumulation>) return compensatedSum(partialSums.data(), blockCount, identity);
+			else return pairwiseSum<double>(partialSums.data(), blockCount, identity);
+		}
+
+#if defined(__SIZEOF_INT128__)
+		/**
+		 * @brief Signed 128-bit integer for exact integer sums
+		*/
+		using WideInteger = __int128;
+#else
+		/**
+		 * @brief Minimal signed 128-bit integer for compilers without __int128, e.g. MSVC. It only supports what the integer reductions need.
+		*/
+		class WideInteger
+		{
+			public:
+				WideInteger() : m_low(0), m_high(0) {}
+
+				template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+				WideInteger(T value) : m_low((uint64_t)value), m_high((std::is_signed_v<T> && value < 0) ? -1 : 0) {}
+
+				WideInteger& operator+=(const WideInteger& other)
+				{
+					uint64_t low = m_low + other.m_low;
+					m_high += other.m_high + (low < m_low ? 1 : 0);
+					m_low = low;
+					return *this;
+				}
+
+				WideInteger operator-(const WideInteger& other) const
+				{
+					WideInteger result;
+					result.m_low = m_low - other.m_low;
+					result.m_high = m_high - other.m_high - (m_low < other.m_low ? 1 : 0);
+					return result;
+				}
+
+				explicit operator double() const
+				{
+					// Convert the magnitude, so that small negative values are exact
+					if (m_high < 0)
+					{
+						WideInteger magnitude = WideInteger() - *this;
+						return -((double)(uint64_t)magnitude.m_high * 18446744073709551616.0 + (double)magnitude.m_low);
+					}
+					return (double)m_high * 18446744073709551616.0 + (double)m_low;
+				}
+
+			private:
+				uint64_t m_low;
+				int64_t m_high;
+		};
+#endif
+
+		/**
+		 * @brief Exact sum of (values[i] - shift) by blocks of REDUCTION_BLOCK_SIZE on several threads.
+		 * Types up to 32 bits are accumulated in int64_t, which can be vectorized and cannot overflow in a block.
+		 * @tparam T Integer type
+		 * @param values Values to be summed
+		 * @param size Number of values
+		 * @param shift Value subtracted from each value
+		 * @param threadCount Number of threads. 0 to use all hardware threads.
+		 * @return Return the exact sum
+		 * @date 2026-10-16
+		*/
+		template <typename T>
+		WideInteger integerSum(const T* values, size_t size, T shift, int threadCount)
+		{
+			size_t blockCount = (size + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+			std::vector<WideInteger> partialSums(blockCount);
+			parallelFor(blockCount, [&](size_t block)
+				{
+					size_t begin = block * REDUCTION_BLOCK_SIZE;
+					size_t end = std::min(begin + REDUCTION_BLOCK_SIZE, size);
+					if constexpr (sizeof(T) <= 4)
+					{
+						int64_t sum = 0;
+						for (size_t i = begin; i < end; i++)
+						{
+							sum += (int64_t)values[i] - (int64_t)shift;
+						}
+						partialSums[block] = sum;
+					}
+					else
+					{
+						WideInteger sum = 0;
+						for (size_t i = begin; i < end; i++)
+						{
+							sum += WideInteger(values[i]) - WideInteger(shift);
+						}
+						partialSums[block] = sum;
+					}
+				},
+				threadCount
+			);
+
+			WideInteger sum = 0;
+			for (size_t i = 0; i < blockCount; i++)
+			{
+				sum += partialSums[i];
+			}
+			return sum;
+		}
+
+		/**
+		 * @brief Integer closest to value in the range of T, used as the shift of integer variance
+		*/
+		template <typename T>
+		T clampToInteger(double value)
+		{
+			if (!(value > (double)std::numeric_limits<T>::min())) return std::numeric_limits<T>::min();
+			if (value >= (double)std::numeric_limits<T>::max()) return std::numeric_limits<T>::max();
+			return static_cast<T>(value);
+		}
+	}
+
+	/**
+	 * @brief Average. Values are summed by pairwise summation, optionally on several threads.
+	 * Integer values are summed exactly in 64-bit or 128-bit integers and converted to double at the end.
+	 * The result is bit-identical for any thread count.
+	 * 
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * double result = average<double>(values);
+	 *
+	 * // Use all hardware threads
+	 * double result = average<double>(values, 0);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam Policy (Option) Accumulation precision policy, passed as a tag argument. Default as DoubleAccumulation. See FloatAccumulation.
+	 * @param values Values to be averaged.
+	 * @param threadCount (Option) Number of threads. Default as 1. Set as 0 to use all hardware threads.
+	 * @return T Return the average value.
+     * @date 2021-03-17
+	 */
+	template <typename R, typename T, typename Policy = DoubleAccumulation>
+	R average(const std::vector<T>& values, int threadCount = 1, Policy = Policy())
+	{
+		static_assert(is_accumulation_policy<Policy>, "Policy must be FloatAccumulation, DoubleAccumulation or CompensatedAccumulation.");
+
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		// Get Size
+		size_t size = values.size();
+		if (size == 0) return 0;
+
+		// Average. Integers are summed exactly and converted at the end.
+		double sum;
+		if constexpr (std::is_integral_v<T>)
+		{
+			sum = (double)Detail::integerSum(values.data(), size, (T)0, threadCount);
+		}
+		else
+		{
+			sum = Detail::parallelSum<Policy>(values.data(), size, [](T value) { return (Detail::Accumulator<Policy>)value; }, threadCount);
+		}
+		double average = sum / (double)size;
+
+		return static_cast<R>(average);
+	};
+
+	/**
+	 * @brief Standard deviation. Values are summed by pairwise summation, optionally on several threads.
+	 * Integer values are centered by an integer close to the mean with exact integer subtraction.
+	 * The result is bit-identical for any thread count.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * double result = stdev<double>(values);
+     * @endcode
 	 * 
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam Policy (Option) Accumulation precision policy, passed as a tag argument. Default as DoubleAccumulation. See FloatAccumulation.
+	 * @param values Values to be applied Standard deviation.
+	 * @param threadCount (Option) Number of threads. Default as 1. Set as 0 to use all hardware threads.
+	 * @return T Return the standard deviation value.
+     * @date 2021-03-17
+	 */
+	template <typename R, typename T, typename Policy = DoubleAccumulation>
+	R stdev(const std::vector<T>& values, int threadCount = 1, Policy = Policy())
+	{
+		static_assert(is_accumulation_policy<Policy>, "Policy must be FloatAccumulation, DoubleAccumulation or CompensatedAccumulation.");
+		using A = Detail::Accumulator<Policy>;
+
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		// Get size
+		size_t size = values.size();
+		if (size == 0) return 0;
+
+		// Calculate average
+		double mean = average<double>(values, threadCount, Policy());
+
+		// Calculate stdev
+		double sum;
+		if constexpr (std::is_integral_v<T>)
+		{
+			// Differences from an integer shift close to the mean are exact, so large integers, e.g. 64-bit counters, do not lose the spread
+			T shift = Detail::clampToInteger<T>(mean);
+			double sumDiff = (double)Detail::integerSum(values.data(), size, shift, threadCount);
+			double sumSquare = Detail::parallelSum<Policy>(values.data(), size,
+				[shift](T value)
+				{
+					A diff;
+					if constexpr (sizeof(T) <= 4) diff = (A)((int64_t)value - (int64_t)shift);
+					else diff = (A)(double)(Detail::WideInteger(value) - Detail::WideInteger(shift));
+					return diff * diff;
+				},
+				threadCount
+			);
+			sum = sumSquare - sumDiff * sumDiff / (double)size;
+			if (sum < 0) sum = 0;
+		}
+		else
+		{
+			const A center = (A)mean;
+			sum = Detail::parallelSum<Policy>(values.data(), size,
+				[center](T value)
+				{
+					A diff = (A)value - center;
+					return diff * diff;
+				},
+				threadCount
+			);
+		}
+
+		double stdev = std::sqrt(sum / (size - 1));
+
+		return static_cast<R>(stdev);
+	};
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Check whether median and quantiles should be counted by Histogram instead of selection.
+		 * Counting is faster from about 256 values for uint8_t and 8192 values for uint16_t.
+		 * @date 2026-10-16
+		*/
+		template <typename T>
+		bool useHistogram(size_t size)
+		{
+			if constexpr (std::is_same_v<T, uint8_t>) return size >= 256;
+			else if constexpr (std::is_same_v<T, uint16_t>) return size >= 8192;
+			else return false;
+		}
+	}
+
+	/**
+	 * @brief Median calculated by selection in O(n). The values will be partially reordered.
+	 * Large uint8_t and uint16_t inputs are counted by Histogram instead and keep their order.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * int result = Utils::medianInPlace<int>(values);
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in, out] values Values to be calculated median. The order of values will be changed.
+	 * @return T Return median
+     * @date 2026-10-16
+	 */
+	template <typename T>
+	T medianInPlace(std::span<T> values)
+	{
+		// Exception
+		if constexpr (!is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		// Get size
+		size_t size = values.size();
+		if (size == 0) return 0;  // Undefined, really.
+
+		// Counting
+		if constexpr (is_histogram_type<T>)
+		{
+			if (Detail::useHistogram<T>(size)) return Histogram<T>(values).median();
+		}
+
+		// Select the upper middle. All values before it are not greater than it.
+		auto middle = values.begin() + size / 2;
+		std::nth_element(values.begin(), middle, values.end());
+		if (size % 2 == 0)
+		{
+			T lowerMiddle = *std::max_element(values.begin(), middle);
+			return (lowerMiddle + *middle) / 2;
+		}
+		else
+		{
+			return *middle;
+		}
+	};
+
+	/**
+	 * @brief Median. Large uint8_t and uint16_t inputs are counted by Histogram without copying.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * int result = median(values);
+     * @endcode
+	 * 
+	 * @tparam T Input Numerical type.
+	 * @param values Values to be calculated median.
+	 * @return T Return median
+     * @date 2021-03-17
+	 */
+	template <typename T>
+	T median(const std::vector<T>& values)
+	{
+		if constexpr (is_histogram_type<T>)
+		{
+			if (Detail::useHistogram<T>(values.size())) return Histogram<T>(values).median();
+		}
+
+		std::vector<T> buffer(values);
+		return medianInPlace(std::span<T>(buffer));
+	};
+
+	/**
+	 * @brief Median calculated on a scratch buffer. The buffer can be reused between calls to avoid allocation.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values;
+	 * std::vector<int> buffer;
+	 * int result = Utils::median<int>(values, &buffer);
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be calculated median.
+	 * @param[in, out] buffer Scratch buffer. Its content will be overwritten.
+	 * @return T Return median
+     * @date 2026-10-16
+	 */
+	template <typename T>
+	T median(std::span<const T> values, std::vector<T>* buffer)
+	{
+		if constexpr (is_histogram_type<T>)
+		{
+			if (Detail::useHistogram<T>(values.size())) return Histogram<T>(values).median();
+		}
+
+		buffer->assign(values.begin(), values.end());
+		return medianInPlace(std::span<T>(*buffer));
+	};
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Select all ranks into place with nth_element(), splitting the range at the middle rank recursively.
+		 * @param first Begin of the values which has the rank of offset
+		 * @param last End of the values
+		 * @param ranksFirst Begin of unique ranks in ascending order
+		 * @param ranksLast End of ranks
+		 * @param offset Rank of first
+		 * @date 2026-10-16
+		*/
+		template <typename Iterator>
+		void multiSelect(Iterator first, Iterator last, const size_t* ranksFirst, const size_t* ranksLast, size_t offset)
+		{
+			if (ranksFirst == ranksLast || first == last) return;
+
+			const size_t* middleRank = ranksFirst + (ranksLast - ranksFirst) / 2;
+			Iterator nth = first + (*middleRank - offset);
+			std::nth_element(first, nth, last);
+
+			multiSelect(first, nth, ranksFirst, middleRank, offset);
+			multiSelect(nth + 1, last, middleRank + 1, ranksLast, *middleRank + 1);
+		}
+	}
+
+	/**
+	 * @brief Calculate several quantiles with linear interpolation between the closest ranks, i.e. value at position q * (size - 1).
+	 * All requested ranks are selected in one recursive partitioning. If 32 ranks or more are needed, the values are sorted by radixSort() instead.
+	 * The values will be partially reordered.
+	 * Large uint8_t and uint16_t inputs are counted by Histogram instead and keep their order.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * std::vector<double> result = Utils::quantilesInPlace<float>(values, { 0.05, 0.5, 0.95 });
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in, out] values Values to be calculated quantiles. The order of values will be changed.
+	 * @param[in] probabilities Probabilities in [0, 1].
+	 * @return Return quantiles in the order of probabilities. Return empty vector if values is empty or any probability is out of range.
+     * @date 2026-10-16
+	 */
+	template <typename T>
+	std::vector<double> quantilesInPlace(std::span<T> values, const std::vector<double>& probabilities)
+	{
+		// Exception
+		if constexpr (!is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		// Check
+		size_t size = values.size();
+		if (size == 0) return std::vector<double>();
+		for (double probability : probabilities)
+		{
+			if (!(probability >= 0.0 && probability <= 1.0)) return std::vector<double>();
+		}
+
+		// Counting
+		if constexpr (is_histogram_type<T>)
+		{
+			if (Detail::useHistogram<T>(size)) return Histogram<T>(values).quantiles(probabilities);
+		}
+
+		// Collect the ranks of both sides of each interpolation
+		std::vector<size_t> ranks;
+		ranks.reserve(probabilities.size() * 2);
+		for (double probability : probabilities)
+		{
+			size_t lower = static_cast<size_t>(probability * (double)(size - 1));
+			ranks.push_back(lower);
+			if (lower + 1 < size) ranks.push_back(lower + 1);
+		}
+		std::sort(ranks.begin(), ranks.end());
+		ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+		// Select. Sorting by radix sort is faster than selecting 32 ranks or more.
+		bool sorted = false;
+		if constexpr (is_radix_type<T>)
+		{
+			if (ranks.size() >= 32)
+			{
+				radixSort(values);
+				sorted = true;
+			}
+		}
+		if (!sorted) Detail::multiSelect(values.begin(), values.end(), ranks.data(), ranks.data() + ranks.size(), 0);
+
+		// Interpolate
+		std::vector<double> result(probabilities.size());
+		for (size_t i = 0; i < probabilities.size(); i++)
+		{
+			double position = probabilities[i] * (double)(size - 1);
+			size_t lower = static_cast<size_t>(position);
+			double fraction = position - (double)lower;
+			double lowerValue = static_cast<double>(values[lower]);
+			result[i] = (lower + 1 < size && fraction > 0.0) ?
+				lowerValue + fraction * (static_cast<double>(values[lower + 1]) - lowerValue) :
+				lowerValue;
+		}
+
+		return result;
+	}
+
+	/**
+	 * @brief Calculate several quantiles with linear interpolation between the closest ranks. See quantilesInPlace().
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * std::vector<double> result = Utils::quantiles(values, { 0.05, 0.5, 0.95 });
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be calculated quantiles.
+	 * @param[in] probabilities Probabilities in [0, 1].
+	 * @return Return quantiles in the order of probabilities. Return empty vector if values is empty or any probability is out of range.
+     * @date 2026-10-16
+	 */
+	template <typename T>
+	std::vector<double> quantiles(const std::vector<T>& values, const std::vector<double>& probabilities)
+	{
+		if constexpr (is_histogram_type<T>)
+		{
+			if (Detail::useHistogram<T>(values.size())) return Histogram<T>(values).quantiles(probabilities);
+		}
+
+		std::vector<T> buffer(values);
+		return quantilesInPlace(std::span<T>(buffer), probabilities);
+	}
+
+	// Weighted statistics
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Weight used by the weighted statistics. Negative, zero and NaN weights are ignored as 0.
+		*/
+		template <typename W>
+		inline double positiveWeight(W weight)
+		{
+			double value = static_cast<double>(weight);
+			return value > 0.0 ? value : 0.0;
+		}
+
+		/**
+		 * @brief Sum of weights[i] and weights[i] * values[i] in four lanes
+		 * @date 2026-10-16
+		*/
+		template <typename T, typename W>
+		void weightedSums(std::span<const T> values, std::span<const W> weights, double* sumWeight, double* sumProduct)
+		{
+			double weightLanes[4] = { 0.0, 0.0, 0.0, 0.0 };
+			double productLanes[4] = { 0.0, 0.0, 0.0, 0.0 };
+			size_t size = values.size();
+			size_t i = 0;
+			for (; i + 4 <= size; i += 4)
+			{
+				for (int lane = 0; lane < 4; lane++)
+				{
+					double weight = positiveWeight(weights[i + lane]);
+					weightLanes[lane] += weight;
+					productLanes[lane] += weight > 0.0 ? weight * static_cast<double>(values[i + lane]) : 0.0;
+				}
+			}
+			for (; i < size; i++)
+			{
+				double weight = positiveWeight(weights[i]);
+				weightLanes[0] += weight;
+				productLanes[0] += weight > 0.0 ? weight * static_cast<double>(values[i]) : 0.0;
+			}
+
+			*sumWeight = (weightLanes[0] + weightLanes[1]) + (weightLanes[2] + weightLanes[3]);
+			*sumProduct = (productLanes[0] + productLanes[1]) + (productLanes[2] + productLanes[3]);
+		}
+	}
+
+	/**
+	 * @brief Weighted average, i.e. sum(weights[i] * values[i]) / sum(weights[i]). Same as average() of the values repeated by their weights,
+	 * without repeating them. Negative, zero and NaN weights are ignored.
+	 *
+     * @code{.cpp}
+     * std::vector<double> values, weights;
+	 * double result = Utils::weightedAverage<double, double, double>(values, weights);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be averaged.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted average. Return 0 if the sizes are different or the total weight is 0.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedAverage(std::span<const T> values, std::span<const W> weights)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T> || !is_numerical<W>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != weights.size()) return 0;
+
+		double sumWeight, sumProduct;
+		Detail::weightedSums(values, weights, &sumWeight, &sumProduct);
+		if (!(sumWeight > 0.0)) return 0;
+
+		return static_cast<R>(sumProduct / sumWeight);
+	}
+
+	/**
+	 * @brief Weighted average. See weightedAverage(std::span<const T>, std::span<const W>).
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be averaged.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted average. Return 0 if the sizes are different or the total weight is 0.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedAverage(const std::vector<T>& values, const std::vector<W>& weights)
+	{
+		return weightedAverage<R>(std::span<const T>(values), std::span<const W>(weights));
+	}
+
+	/**
+	 * @brief Weighted standard deviation with frequency weights, i.e. sqrt(sum(weights[i] * (values[i] - mean)^2) / (sum(weights[i]) - 1)).
+	 * Same as stdev() of the values repeated by their weights, without repeating them. Negative, zero and NaN weights are ignored.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * std::vector<int> counts;
+	 * double result = Utils::weightedStdev<double, float, int>(values, counts);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be applied Standard deviation.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted standard deviation. Return 0 if the sizes are different or the total weight is not larger than 1.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedStdev(std::span<const T> values, std::span<const W> weights)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T> || !is_numerical<W>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != weights.size()) return 0;
+
+		// Weighted mean
+		double sumWeight, sumProduct;
+		Detail::weightedSums(values, weights, &sumWeight, &sumProduct);
+		if (!(sumWeight > 1.0)) return 0;
+		const double mean = sumProduct / sumWeight;
+
+		// Weighted squared differences
+		double lanes[4] = { 0.0, 0.0, 0.0, 0.0 };
+		size_t size = values.size();
+		size_t i = 0;
+		for (; i + 4 <= size; i += 4)
+		{
+			for (int lane = 0; lane < 4; lane++)
+			{
+				double weight = Detail::positiveWeight(weights[i + lane]);
+				double diff = static_cast<double>(values[i + lane]) - mean;
+				lanes[lane] += weight > 0.0 ? weight * diff * diff : 0.0;
+			}
+		}
+		for (; i < size; i++)
+		{
+			double weight = Detail::positiveWeight(weights[i]);
+			double diff = static_cast<double>(values[i]) - mean;
+			lanes[0] += weight > 0.0 ? weight * diff * diff : 0.0;
+		}
+		double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+
+		return static_cast<R>(std::sqrt(sum / (sumWeight - 1.0)));
+	}
+
+	/**
+	 * @brief Weighted standard deviation with frequency weights. See weightedStdev(std::span<const T>, std::span<const W>).
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be applied Standard deviation.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted standard deviation. Return 0 if the sizes are different or the total weight is not larger than 1.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedStdev(const std::vector<T>& values, const std::vector<W>& weights)
+	{
+		return weightedStdev<R>(std::span<const T>(values), std::span<const W>(weights));
+	}
+
+	/**
+	 * @brief Weighted median calculated by weighted selection in O(n), i.e. the smallest value which cumulative weight reaches half of the total weight.
+	 * If the cumulative weight is exactly half, the mean of it and the next value is returned,
+	 * so it is the same as median() of the values repeated by integer weights. Negative, zero and NaN weights are ignored.
+	 * Only the (value, weight) pairs are copied.
+	 *
+     * @code{.cpp}
+     * std::vector<double> values, weights;
+	 * double result = Utils::weightedMedian<double, double, double>(values, weights);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be calculated median.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted median. Return 0 if the sizes are different or the total weight is 0.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedMedian(std::span<const T> values, std::span<const W> weights)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T> || !is_numerical<W>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != weights.size()) return 0;
+
+		// Copy pairs with positive weight
+		std::vector<std::pair<double, double>> pairs;
+		pairs.reserve(values.size());
+		double totalWeight = 0.0;
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			double weight = Detail::positiveWeight(weights[i]);
+			if (weight > 0.0)
+			{
+				pairs.emplace_back(static_cast<double>(values[i]), weight);
+				totalWeight += weight;
+			}
+		}
+		if (pairs.empty()) return 0;
+
+		// Weighted selection. All values before first are not greater than the range, and their weight is below.
+		auto byValue = [](const std::pair<double, double>& a, const std::pair<double, double>& b) { return a.first < b.first; };
+		const double halfWeight = totalWeight / 2.0;
+		auto first = pairs.begin();
+		auto last = pairs.end();
+		double below = 0.0;
+		while (last - first > 1)
+		{
+			auto middle = first + (last - first) / 2;
+			std::nth_element(first, middle, last, byValue);
+
+			double leftWeight = 0.0;
+			for (auto it = first; it != middle; it++)
+			{
+				leftWeight += it->second;
+			}
+
+			if (below + leftWeight >= halfWeight)
+			{
+				last = middle;
+			}
+			else if (below + leftWeight + middle->second >= halfWeight)
+			{
+				below += leftWeight;
+				first = middle;
+				last = middle + 1;
+			}
+			else
+			{
+				below += leftWeight + middle->second;
+				first = middle + 1;
+			}
+		}
+		if (first == pairs.end()) first--; // Rounding of the weight sums
+
+		// The cumulative weight is exactly half, take the mean with the next value
+		double result = first->first;
+		if (below + first->second == halfWeight && first + 1 != pairs.end())
+		{
+			double next = std::min_element(first + 1, pairs.end(), byValue)->first;
+			result = (result + next) / 2.0;
+		}
+
+		return static_cast<R>(result);
+	}
+
+	/**
+	 * @brief Weighted median. See weightedMedian(std::span<const T>, std::span<const W>).
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @tparam W Weight Numerical type.
+	 * @param values Values to be calculated median.
+	 * @param weights Weights of values. It must have the same size as values.
+	 * @return Return the weighted median. Return 0 if the sizes are different or the total weight is 0.
+     * @date 2026-10-16
+	 */
+	template <typename R, typename T, typename W>
+	R weightedMedian(const std::vector<T>& values, const std::vector<W>& weights)
+	{
+		return weightedMedian<R>(std::span<const T>(values), std::span<const W>(weights));
+	}
+
+	// Outlier rejection
+
+	/**
+	 * @brief Iterative sigma clipping. Values outside mean +/- k * stdev are flagged as rejected and the bounds are recalculated
+	 * from the remaining values until no value is rejected or maxIteration is reached.
+	 * The sums are updated by subtracting only the rejected values, so each iteration is a single scan without moving any data,
+	 * instead of recalculating average(), stdev() and removeByIndices() every iteration. The sums are recalculated from the remaining
+	 * values only if the rejected values dominate them, e.g. a huge outlier. Values which are not finite (NaN and inf) are always rejected.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * Utils::BitMask rejected;
+	 * Utils::Statistics stats = Utils::sigmaClip(std::span<const float>(values), 3.0, 5, &rejected);
+	 * for (size_t i = 0; i < values.size(); i++)
+	 * {
+	 *     if (!rejected.test(i)) ...
+	 * }
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be clipped.
+	 * @param[in] k Number of standard deviations of the bounds.
+	 * @param[in] maxIteration (Option) Maximum number of iterations. Default as 5.
+	 * @param[out] rejectedMask (Option) Bit i is set if values[i] is rejected. Default as NULL.
+	 * @return Return the statistics of the remaining values. All fields are 0 if no value remains.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	Statistics sigmaClip(std::span<const T> values, double k, int maxIteration = 5, BitMask* rejectedMask = NULL)
+	{
+		// Exception
+		if constexpr (!is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		size_t size = values.size();
+		BitMask rejected(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			if (!std::isfinite(static_cast<double>(values[i]))) rejected.set(i);
+		}
+
+		// Shift by the mean of the remaining values, so the subtraction of the sums does not suffer from cancellation
+		double shift = 0.0;
+		double sum = 0.0; // Sum of shifted values
+		double sumSquare = 0.0;
+		size_t count = 0;
+		auto recalculate = [&]()
+		{
+			shift = 0.0;
+			count = 0;
+			for (size_t i = 0; i < size; i++)
+			{
+				if (rejected.test(i)) continue;
+				shift += static_cast<double>(values[i]);
+				count++;
+			}
+			if (count > 0) shift /= (double)count;
+
+			sum = 0.0;
+			sumSquare = 0.0;
+			for (size_t i = 0; i < size; i++)
+			{
+				if (rejected.test(i)) continue;
+				double diff = static_cast<double>(values[i]) - shift;
+				sum += diff;
+				sumSquare += diff * diff;
+			}
+		};
+		recalculate();
+
+		// Clip
+		for (int iteration = 0; iteration < maxIteration && count > 1; iteration++)
+		{
+			double mean = sum / (double)count;
+			double m2 = sumSquare - sum * mean;
+			double stdev = std::sqrt((m2 > 0.0 ? m2 : 0.0) / (double)(count - 1));
+			double lower = shift + mean - k * stdev;
+			double upper = shift + mean + k * stdev;
+
+			size_t rejectedCount = 0;
+			double rejectedSumSquare = 0.0;
+			for (size_t i = 0; i < size; i++)
+			{
+				double value = static_cast<double>(values[i]);
+				if ((value < lower || value > upper) && !rejected.test(i))
+				{
+					rejected.set(i);
+					double diff = value - shift;
+					sum -= diff;
+					sumSquare -= diff * diff;
+					rejectedSumSquare += diff * diff;
+					rejectedCount++;
+				}
+			}
+			if (rejectedCount == 0) break;
+			count -= rejectedCount;
+
+			// The subtraction loses the precision of the remaining values if the rejected squares dominate the sum of squares,
+			// or if the remaining values are far from the shift, e.g. the shift was pulled by a huge outlier. Recalculate with a new shift.
+			if (count > 0 && (rejectedSumSquare > sumSquare || 2.0 * sum * sum > sumSquare * (double)count)) recalculate();
+		}
+
+		// Statistics of the remaining values
+		Statistics result;
+		if (count > 0)
+		{
+			double minValue = std::numeric_limits<double>::infinity();
+			double maxValue = -std::numeric_limits<double>::infinity();
+			for (size_t i = 0; i < size; i++)
+			{
+				if (rejected.test(i)) continue;
+				double value = static_cast<double>(values[i]);
+				minValue = value < minValue ? value : minValue;
+				maxValue = value > maxValue ? value : maxValue;
+			}
+
+			result.count = count;
+			result.mean = shift + sum / (double)count;
+			result.sum = result.mean * (double)count;
+			if (count > 1)
+			{
+				double m2 = sumSquare - sum * sum / (double)count;
+				result.variance = (m2 > 0.0 ? m2 : 0.0) / (double)(count - 1);
+			}
+			result.stdev = std::sqrt(result.variance);
+			result.min = minValue;
+			result.max = maxValue;
+		}
+
+		if (rejectedMask != NULL) *rejectedMask = std::move(rejected);
+		return result;
+	}
+
+	/**
+	 * @brief Iterative sigma clipping. See sigmaClip(std::span<const T>, double, int, BitMask*).
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be clipped.
+	 * @param[in] k Number of standard deviations of the bounds.
+	 * @param[in] maxIteration (Option) Maximum number of iterations. Default as 5.
+	 * @param[out] rejectedMask (Option) Bit i is set if values[i] is rejected. Default as NULL.
+	 * @return Return the statistics of the remaining values. All fields are 0 if no value remains.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	Statistics sigmaClip(const std::vector<T>& values, double k, int maxIteration = 5, BitMask* rejectedMask = NULL)
+	{
+		return sigmaClip(std::span<const T>(values), k, maxIteration, rejectedMask);
+	}
+
+	// Normalization
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief result[i] = (values[i] - offset) * scale. Float is calculated in float, others in double.
+		 * values and result can be the same memory.
+		 * @date 2026-10-16
+		*/
+		template <typename R, typename T>
+		void applyAffine(const T* values, R* result, size_t size, double offset, double scale)
+		{
+			using C = std::conditional_t<std::is_same_v<T, float> && std::is_same_v<R, float>, float, double>;
+			const C offsetValue = static_cast<C>(offset);
+			const C scaleValue = static_cast<C>(scale);
+			for (size_t i = 0; i < size; i++)
+			{
+				result[i] = static_cast<R>((static_cast<C>(values[i]) - offsetValue) * scaleValue);
+			}
+		}
+	}
+
+	/**
+	 * @brief Min-max normalization with precomputed parameters, i.e. result[i] = (values[i] - min) / (max - min).
+	 * It applies the same transform as a previous normalizeMinMax() on new data.
+	 *
+     * @code{.cpp}
+     * Utils::Statistics parameters;
+	 * Utils::normalizeMinMax<float, float>(trainingValues, trainingResult, &parameters);
+	 * Utils::normalizeMinMax<float, float>(newValues, newResult, parameters);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be normalized.
+	 * @param[out] result Normalized values. It must have the same size as values, and it can be the same memory as values.
+	 * @param[in] statistics Parameters. Only min and max are used. All results are 0 if max is equal to min.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool normalizeMinMax(std::span<const T> values, std::span<R> result, const Statistics& statistics)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != result.size()) return false;
+
+		double range = statistics.max - statistics.min;
+		double scale = range > 0.0 ? 1.0 / range : 0.0;
+		Detail::applyAffine(values.data(), result.data(), values.size(), statistics.min, scale);
+		return true;
+	}
+
+	/**
+	 * @brief Min-max normalization, i.e. result[i] = (values[i] - min) / (max - min). The parameters are calculated by describe() in one pass,
+	 * and applied in a second pass, instead of average(), stdev(), subtraction() and divideBy() with constant vectors.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * Utils::normalizeMinMax<float, float>(values, values); // In place
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be normalized.
+	 * @param[out] result Normalized values in [0, 1]. It must have the same size as values, and it can be the same memory as values.
+	 * @param[out] statistics (Option) Statistics of values to normalize other data in the same way. Default as NULL.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool normalizeMinMax(std::span<const T> values, std::span<R> result, Statistics* statistics = NULL)
+	{
+		if (values.size() != result.size()) return false;
+
+		Statistics parameters = describe(values);
+		if (statistics != NULL) *statistics = parameters;
+		return normalizeMinMax(values, result, parameters);
+	}
+
+	/**
+	 * @brief Z-score standardization with precomputed parameters, i.e. result[i] = (values[i] - mean) / stdev.
+	 * It applies the same transform as a previous standardize() on new data.
+	 *
+     * @code{.cpp}
+     * Utils::Statistics parameters;
+	 * Utils::standardize<float, float>(trainingValues, trainingResult, &parameters);
+	 * Utils::standardize<float, float>(newValues, newResult, parameters);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be standardized.
+	 * @param[out] result Standardized values. It must have the same size as values, and it can be the same memory as values.
+	 * @param[in] statistics Parameters. Only mean and stdev are used. All results are 0 if stdev is 0.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool standardize(std::span<const T> values, std::span<R> result, const Statistics& statistics)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != result.size()) return false;
+
+		double scale = statistics.stdev > 0.0 ? 1.0 / statistics.stdev : 0.0;
+		Detail::applyAffine(values.data(), result.data(), values.size(), statistics.mean, scale);
+		return true;
+	}
+
+	/**
+	 * @brief Z-score standardization, i.e. result[i] = (values[i] - mean) / stdev with the sample standard deviation.
+	 * The parameters are calculated by describe() in one pass, and applied in a second pass.
+	 *
+     * @code{.cpp}
+     * std::vector<double> values;
+	 * std::vector<double> result(values.size());
+	 * Utils::standardize<double, double>(values, result);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be standardized.
+	 * @param[out] result Standardized values. It must have the same size as values, and it can be the same memory as values.
+	 * @param[out] statistics (Option) Statistics of values to standardize other data in the same way. Default as NULL.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool standardize(std::span<const T> values, std::span<R> result, Statistics* statistics = NULL)
+	{
+		if (values.size() != result.size()) return false;
+
+		Statistics parameters = describe(values);
+		if (statistics != NULL) *statistics = parameters;
+		return standardize(values, result, parameters);
+	}
+
+	// Scan
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Prefix sum by blocks of REDUCTION_BLOCK_SIZE. The block totals are summed first in parallel, and then every block is scanned
+		 * from its offset in parallel. On one thread, both are done in a single pass which gives the same sums.
+		 * The blocks never depend on the thread count, so the result is deterministic for any thread count. For floating point, it is not equal to
+		 * a plain sequential scan, because offset + (v0 + v1 + ...) is rounded differently from ((offset + v0) + v1) + ....
+		 * values and result can be the same memory.
+		 * @param values Values to be scanned
+		 * @param result Prefix sums
+		 * @param size Number of values
+		 * @param initial Value added to all prefix sums
+		 * @param inclusive Include values[i] in result[i]
+		 * @param threadCount Number of threads. 0 to use all hardware threads.
+		 * @date 2026-10-16
+		*/
+		template <typename R, typename T>
+		void blockScan(const T* values, R* result, size_t size, R initial, bool inclusive, int threadCount)
+		{
+			if (size == 0) return;
+			size_t blockCount = (size + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+
+			// Single pass. The total of each block is summed beside the running sum, so the offsets are the same as the parallel passes.
+			if (threadCount == 1)
+			{
+				R offset = initial;
+				for (size_t block = 0; block < blockCount; block++)
+				{
+					size_t begin = block * REDUCTION_BLOCK_SIZE;
+					size_t end = std::min(size, begin + REDUCTION_BLOCK_SIZE);
+					R running = offset;
+					R total = 0;
+					for (size_t i = begin; i < end; i++)
+					{
+						R value = static_cast<R>(values[i]);
+						if (!inclusive) result[i] = running;
+						running += value;
+						total += value;
+						if (inclusive) result[i] = running;
+					}
+					offset += total;
+				}
+				return;
+			}
+
+			// Offsets of blocks, i.e. initial plus the totals of all previous blocks
+			std::vector<R> offsets(blockCount, 0);
+			if (blockCount > 1)
+			{
+				parallelFor(blockCount - 1, [&](size_t block)
+					{
+						size_t begin = block * REDUCTION_BLOCK_SIZE;
+						R total = 0;
+						for (size_t i = begin; i < begin + REDUCTION_BLOCK_SIZE; i++)
+						{
+							total += static_cast<R>(values[i]);
+						}
+						offsets[block + 1] = total;
+					},
+					threadCount
+				);
+			}
+			offsets[0] = initial;
+			for (size_t block = 1; block < blockCount; block++)
+			{
+				offsets[block] += offsets[block - 1];
+			}
+
+			// Scan blocks
+			parallelFor(blockCount, [&](size_t block)
+				{
+					size_t begin = block * REDUCTION_BLOCK_SIZE;
+					size_t end = std::min(size, begin + REDUCTION_BLOCK_SIZE);
+					R running = offsets[block];
+					if (inclusive)
+					{
+						for (size_t i = begin; i < end; i++)
+						{
+							running += static_cast<R>(values[i]);
+							result[i] = running;
+						}
+					}
+					else
+					{
+						for (size_t i = begin; i < end; i++)
+						{
+							R value = static_cast<R>(values[i]);
+							result[i] = running;
+							running += value;
+						}
+					}
+				},
+				threadCount
+			);
+		}
+	}
+
+	/**
+	 * @brief Inclusive scan, i.e. result[i] = values[0] + ... + values[i], optionally on several threads.
+	 * The result is deterministic for any thread count. For floating point, it can differ from a plain sequential loop in the last bits.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values = { 1, 2, 3 };
+	 * std::vector<int64_t> result(values.size());
+	 * Utils::inclusiveScan<int64_t, int>(values, result); // 1, 3, 6
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type. Sums are accumulated in R.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be scanned.
+	 * @param[out] result Prefix sums. It must have the same size as values, and it can be the same memory as values.
+	 * @param[in] threadCount (Option) Number of threads. Default as 1. Set as 0 to use all hardware threads.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool inclusiveScan(std::span<const T> values, std::span<R> result, int threadCount = 1)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != result.size()) return false;
+
+		Detail::blockScan(values.data(), result.data(), values.size(), (R)0, true, threadCount);
+		return true;
+	}
+
+	/**
+	 * @brief Exclusive scan, i.e. result[0] = initial and result[i] = initial + values[0] + ... + values[i - 1], optionally on several threads.
+	 * The result is deterministic for any thread count. For floating point, it can differ from a plain sequential loop in the last bits.
+	 *
+     * @code{.cpp}
+     * std::vector<int> values = { 1, 2, 3 };
+	 * std::vector<int64_t> result(values.size());
+	 * Utils::exclusiveScan<int64_t, int>(values, result); // 0, 1, 3
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type. Sums are accumulated in R.
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be scanned.
+	 * @param[out] result Prefix sums. It must have the same size as values, and it can be the same memory as values.
+	 * @param[in] initial (Option) Value of the first prefix sum. Default as 0.
+	 * @param[in] threadCount (Option) Number of threads. Default as 1. Set as 0 to use all hardware threads.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T>
+	bool exclusiveScan(std::span<const T> values, std::span<R> result, R initial = 0, int threadCount = 1)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T>)
+			throw "This funciton only support numerical type.";
+
+		if (values.size() != result.size()) return false;
+
+		Detail::blockScan(values.data(), result.data(), values.size(), initial, false, threadCount);
+		return true;
+	}
+
+	// Min and max
+
+	/**
+	 * @brief How argmin() and argmax() treat NaN
+	 * @li Ignore: Skip NaN values.
+	 * @li Propagate: Return the index of the first NaN if there is any, like a comparison chain in which NaN wins.
+     * @date 2026-10-16
+	*/
+	enum class NanPolicy
+	{
+		Ignore,
+		Propagate
+	};
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Index of the minimum or maximum value. Float and double use the SIMD kernels, others use four lanes.
+		 * @return Return the index. Return size if values is empty or all values are NaN and ignored.
+		 * @date 2026-10-16
+		*/
+		template <typename T>
+		size_t argExtreme(std::span<const T> values, bool findMax, NanPolicy nanPolicy)
+		{
+			// Exception
+			if constexpr (!is_numerical<T>)
+				throw "This funciton only support numerical type.";
+
+			size_t size = values.size();
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			{
+				bool hasNan = false;
+				size_t index = Utils::argExtreme(values.data(), size, findMax, &hasNan);
+				if (hasNan && nanPolicy == NanPolicy::Propagate)
+				{
+					for (size_t i = 0; i < size; i++)
+					{
+						if (values[i] != values[i]) return i;
+					}
+				}
+				return index;
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				size_t index = size;
+				for (size_t i = 0; i < size; i++)
+				{
+					if (values[i] != values[i])
+					{
+						if (nanPolicy == NanPolicy::Propagate) return i;
+					}
+					else if (index == size || (findMax ? values[i] > values[index] : values[i] < values[index]))
+					{
+						index = i;
+					}
+				}
+				return index;
+			}
+			else
+			{
+				if (size == 0) return size;
+
+				// Four lanes keep the best of every fourth value, and ties are resolved by the index at the end
+				size_t bestIndex[4] = { 0, 0, 0, 0 };
+				T best[4] = { values[0], values[0], values[0], values[0] };
+				size_t i = 0;
+				for (; i + 4 <= size; i += 4)
+				{
+					for (int lane = 0; lane < 4; lane++)
+					{
+						T value = values[i + lane];
+						bool better = findMax ? value > best[lane] : value < best[lane];
+						best[lane] = better ? value : best[lane];
+						bestIndex[lane] = better ? i + lane : bestIndex[lane];
+					}
+				}
+				for (; i < size; i++)
+				{
+					bool better = findMax ? values[i] > best[0] : values[i] < best[0];
+					best[0] = better ? values[i] : best[0];
+					bestIndex[0] = better ? i : bestIndex[0];
+				}
+
+				size_t index = bestIndex[0];
+				for (int lane = 1; lane < 4; lane++)
+				{
+					T value = values[bestIndex[lane]];
+					bool better = findMax ? value > values[index] : value < values[index];
+					if (better || (value == values[index] && bestIndex[lane] < index)) index = bestIndex[lane];
+				}
+				return index;
+			}
+		}
+	}
+
+	/**
+	 * @brief Index of the minimum value in one pass. Float and double are vectorized by the SIMD kernels.
+	 * If several values are equal to the minimum, the first index is returned.
+	 *
+     * @code{.cpp}
+     * std::vector<float> spectrum;
+	 * size_t index = Utils::argmin(std::span<const float>(spectrum));
+	 * if (index < spectrum.size()) ...
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be searched.
+	 * @param[in] nanPolicy (Option) How NaN is treated. Default as NanPolicy::Ignore.
+	 * @return Return the index of the minimum value. Return values.size() if values is empty or all values are NaN.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	size_t argmin(std::span<const T> values, NanPolicy nanPolicy = NanPolicy::Ignore)
+	{
+		return Detail::argExtreme(values, false, nanPolicy);
+	}
+
+	/**
+	 * @brief Index of the minimum value. See argmin(std::span<const T>, NanPolicy).
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be searched.
+	 * @param[in] nanPolicy (Option) How NaN is treated. Default as NanPolicy::Ignore.
+	 * @return Return the index of the minimum value. Return values.size() if values is empty or all values are NaN.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	size_t argmin(const std::vector<T>& values, NanPolicy nanPolicy = NanPolicy::Ignore)
+	{
+		return Detail::argExtreme(std::span<const T>(values), false, nanPolicy);
+	}
+
+	/**
+	 * @brief Index of the maximum value in one pass. Float and double are vectorized by the SIMD kernels.
+	 * If several values are equal to the maximum, the first index is returned.
+	 *
+     * @code{.cpp}
+     * std::vector<float> spectrum;
+	 * size_t peak = Utils::argmax(std::span<const float>(spectrum), Utils::NanPolicy::Propagate);
+     * @endcode
+	 *
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be searched.
+	 * @param[in] nanPolicy (Option) How NaN is treated. Default as NanPolicy::Ignore.
+	 * @return Return the index of the maximum value. Return values.size() if values is empty or all values are NaN.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	size_t argmax(std::span<const T> values, NanPolicy nanPolicy = NanPolicy::Ignore)
+	{
+		return Detail::argExtreme(values, true, nanPolicy);
+	}
+
+	/**
+	 * @brief Index of the maximum value. See argmax(std::span<const T>, NanPolicy).
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be searched.
+	 * @param[in] nanPolicy (Option) How NaN is treated. Default as NanPolicy::Ignore.
+	 * @return Return the index of the maximum value. Return values.size() if values is empty or all values are NaN.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	size_t argmax(const std::vector<T>& values, NanPolicy nanPolicy = NanPolicy::Ignore)
+	{
+		return Detail::argExtreme(std::span<const T>(values), true, nanPolicy);
+	}
+
+	/**
+	 * @brief Indices of the k largest (or smallest) values in O(n log k) with a heap of k indices, instead of sorting all values.
+	 * Most values are rejected by a single comparison with the worst kept value. NaN is skipped.
+	 *
      * @code{.cpp}
-     * std::vector<int> values;
-	 * double result = average<double>(values);
+     * std::vector<float> spectrum;
+	 * std::vector<size_t> peaks = Utils::topK(std::span<const float>(spectrum), 5);
      * @endcode
 	 *
-	 * @tparam R Return Numerical type.
 	 * @tparam T Input Numerical type.
-	 * @param values Values to be averaged.
-	 * @return T Return the average value.
-     * @date 2021-03-17
-	 */
-	template <typename R, typename T>
-	R average(std::vector<T> values)
+	 * @param[in] values Values to be selected.
+	 * @param[in] k Number of values to be selected.
+	 * @param[in] largest (Option) Select the largest values if true, otherwise the smallest. Default as true.
+	 * @return Return the indices from the best value. Equal values are in the order of index. The size is less than k if there are not enough numbers.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	std::vector<size_t> topK(std::span<const T> values, size_t k, bool largest = true)
 	{
 		// Exception
-		if constexpr (!is_numerical<R> || !is_numerical<T>)
+		if constexpr (!is_numerical<T>)
 			throw "This funciton only support numerical type.";
 
-		// Get Size
-		size_t size = values.size();
-		if (size == 0) return 0;
+		std::vector<size_t> heap;
+		if (k == 0) return heap;
+		heap.reserve(std::min(k, values.size()));
 
-		// Average
-		double average = 0.0;
-		for (int i = 0; i < size; i++)
+		// The heap keeps the worst of the selected values on top
+		auto better = [&](size_t a, size_t b)
 		{
-			average += values[i];
+			if (values[a] != values[b]) return largest ? values[a] > values[b] : values[a] < values[b];
+			return a < b;
+		};
+
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			if (values[i] != values[i]) continue;
+
+			if (heap.size() < k)
+			{
+				heap.push_back(i);
+				std::push_heap(heap.begin(), heap.end(), better);
+			}
+			else if (better(i, heap.front()))
+			{
+				std::pop_heap(heap.begin(), heap.end(), better);
+				heap.back() = i;
+				std::push_heap(heap.begin(), heap.end(), better);
+			}
 		}
-		average = average / (double)size;
 
-		return static_cast<R>(average);
-	};
+		std::sort_heap(heap.begin(), heap.end(), better);
+		return heap;
+	}
+
+	/**
+	 * @brief Indices of the k largest (or smallest) values. See topK(std::span<const T>, size_t, bool).
+	 * @tparam T Input Numerical type.
+	 * @param[in] values Values to be selected.
+	 * @param[in] k Number of values to be selected.
+	 * @param[in] largest (Option) Select the largest values if true, otherwise the smallest. Default as true.
+	 * @return Return the indices from the best value. Equal values are in the order of index. The size is less than k if there are not enough numbers.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	std::vector<size_t> topK(const std::vector<T>& values, size_t k, bool largest = true)
+	{
+		return topK(std::span<const T>(values), k, largest);
+	}
+
+	// Math Operator
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Integer types to calculate R = T1 op T2 of integers. The type is wide enough for R and both inputs, i.e. int64_t for types up to 32 bits,
+		 * which holds any sum, difference or product of them, and a 128-bit integer for 64-bit types if the compiler has it. It is signed if any type is signed.
+		 * Addition, subtraction and multiplication are done in the unsigned type of the same width, so overflow of R wraps around instead of being undefined.
+		 * @date 2026-10-17
+		*/
+		template <typename R, typename T1, typename T2>
+		struct ElementwiseInteger
+		{
+			static constexpr bool isSigned = std::is_signed_v<R> || std::is_signed_v<T1> || std::is_signed_v<T2>;
+#if defined(__SIZEOF_INT128__)
+			static constexpr bool isWide = sizeof(R) > 4 || sizeof(T1) > 4 || sizeof(T2) > 4;
+			using type = std::conditional_t<isWide, std::conditional_t<isSigned, __int128, unsigned __int128>, std::conditional_t<isSigned, int64_t, uint64_t>>;
+			using unsignedType = std::conditional_t<isWide, unsigned __int128, uint64_t>;
+#else
+			using type = std::conditional_t<isSigned, int64_t, uint64_t>;
+			using unsignedType = uint64_t;
+#endif
+		};
+
+		/**
+		 * @brief result[i] = values1[i] op values2[i]. Use the SIMD kernels if all types are the same SIMD type.
+		 * Otherwise integers are calculated in ElementwiseInteger and others in double.
+		 * @param op Operator
+		 * @param values1 Values 1
+		 * @param values2 Values 2
+		 * @param result Result
+		 * @param size Number of values
+		 * @date 2026-10-16
+		*/
+		template <typename R, typename T1, typename T2>
+		void applyElementwise(ElementwiseOperator op, const T1* values1, const T2* values2, R* result, size_t size)
+		{
+			if constexpr (std::is_same_v<R, T1> && std::is_same_v<R, T2> && is_simd_type<R>)
+			{
+				if (elementwise(op, values1, values2, result, size)) return;
+			}
+
+			// Integers are calculated exactly in a type wide enough for R and both inputs instead of double.
+			// Values are sign extended into C first, so the unsigned result equals the exact result modulo 2^64 (or 2^128).
+			if constexpr (std::is_integral_v<R> && std::is_integral_v<T1> && std::is_integral_v<T2>)
+			{
+				using C = typename ElementwiseInteger<R, T1, T2>::type;
+				using U = typename ElementwiseInteger<R, T1, T2>::unsignedType;
+				switch (op)
+				{
+				case ElementwiseOperator::Addition:
+					for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((U)(C)values1[i] + (U)(C)values2[i]);
+					break;
+				case ElementwiseOperator::Subtraction:
+					for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((U)(C)values1[i] - (U)(C)values2[i]);
+					break;
+				case ElementwiseOperator::Multiple:
+					for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((U)(C)values1[i] * (U)(C)values2[i]);
+					break;
+				case ElementwiseOperator::Division:
+					for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((C)values1[i] / (C)values2[i]);
+					break;
+				}
+				return;
+			}
+
+			switch (op)
+			{
+			case ElementwiseOperator::Addition:
+				for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((double)values1[i] + (double)values2[i]);
+				break;
+			case ElementwiseOperator::Subtraction:
+				for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((double)values1[i] - (double)values2[i]);
+				break;
+			case ElementwiseOperator::Multiple:
+				for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((double)values1[i] * (double)values2[i]);
+				break;
+			case ElementwiseOperator::Division:
+				for (size_t i = 0; i < size; i++) result[i] = static_cast<R>((double)values1[i] / (double)values2[i]);
+				break;
+			}
+		}
+	}
 
 	/**
-	 * @brief Standard deviation
+	 * @brief Values1 + Values2 into a caller provided buffer. No allocation. See addition().
 	 *
      * @code{.cpp}
-     * std::vector<int> values;
-	 * double result = stdev<double>(values);
+     * std::vector<int> values1;
+     * std::vector<long> values2;
+	 * std::vector<double> result(values1.size());
+	 * bool success = Utils::addition<double, int, long>(values1, values2, result);
      * @endcode
-	 * 
+	 *
 	 * @tparam R Return Numerical type.
-	 * @tparam T Input Numerical type.
-	 * @param values Values to be applied Standard deviation.
-	 * @return T Return the standard deviation value.
-     * @date 2021-03-17
-	 */
-	template <typename R, typename T>
-	R stdev(std::vector<T> values)
+	 * @tparam T1 Input Numerical type 1.
+	 * @tparam T2 Input Numerical type 2.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result. It can be the same buffer as values1 or values2.
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T1, typename T2>
+	bool addition(std::span<const T1> values1, std::span<const T2> values2, std::span<R> result)
 	{
 		// Exception
-		if constexpr (!is_numerical<R> || !is_numerical<T>)
+		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
 			throw "This funciton only support numerical type.";
 
-		// Get size
-		size_t size = values.size();
-		if (size == 0) return 0;
+		// Check size
+		if (values1.size() != values2.size() || values1.size() != result.size()) return false;
 
-		// Calculate average
-		double mean = average<double>(values);
+		// Calculate
+		Detail::applyElementwise(ElementwiseOperator::Addition, values1.data(), values2.data(), result.data(), result.size());
 
-		// Calculate stdev
-		double sum = 0;
-		for (int i = 0; i < size; i++)
-		{
-			double diff = (values[i] - mean);
-			sum += diff * diff;
-		}
+		return true;
+	}
 
-		double stdev = std::sqrt(sum / (size - 1));
+	/**
+	 * @brief Values1 += Values2. No allocation. See addition().
+	 *
+     * @code{.cpp}
+     * std::vector<float> values1;
+     * std::vector<float> values2;
+	 * bool success = Utils::additionInPlace<float, float>(values1, values2);
+     * @endcode
+	 *
+	 * @tparam T1 Numerical type 1.
+	 * @tparam T2 Numerical type 2.
+	 * @param[in, out] values1 Values 1 to be updated
+	 * @param[in] values2 Values 2
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename T1, typename T2>
+	bool additionInPlace(std::span<T1> values1, std::span<const T2> values2)
+	{
+		return addition<T1, T1, T2>(values1, values2, values1);
+	}
 
-		return static_cast<R>(stdev);
-	};
+	/**
+	 * @brief Values1 - Values2 into a caller provided buffer. No allocation. See subtraction().
+	 *
+     * @code{.cpp}
+     * std::vector<int> values1;
+     * std::vector<long> values2;
+	 * std::vector<double> result(values1.size());
+	 * bool success = Utils::subtraction<double, int, long>(values1, values2, result);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T1 Input Numerical type 1.
+	 * @tparam T2 Input Numerical type 2.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result. It can be the same buffer as values1 or values2.
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T1, typename T2>
+	bool subtraction(std::span<const T1> values1, std::span<const T2> values2, std::span<R> result)
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
+			throw "This funciton only support numerical type.";
+
+		// Check size
+		if (values1.size() != values2.size() || values1.size() != result.size()) return false;
+
+		// Calculate
+		Detail::applyElementwise(ElementwiseOperator::Subtraction, values1.data(), values2.data(), result.data(), result.size());
+
+		return true;
+	}
 
 	/**
-	 * @brief Median
+	 * @brief Values1 -= Values2. No allocation. See subtraction().
 	 *
      * @code{.cpp}
-     * std::vector<int> values;
-	 * double result = median<double>(values);
+     * std::vector<float> values1;
+     * std::vector<float> values2;
+	 * bool success = Utils::subtractionInPlace<float, float>(values1, values2);
      * @endcode
-	 * 
+	 *
+	 * @tparam T1 Numerical type 1.
+	 * @tparam T2 Numerical type 2.
+	 * @param[in, out] values1 Values 1 to be updated
+	 * @param[in] values2 Values 2
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename T1, typename T2>
+	bool subtractionInPlace(std::span<T1> values1, std::span<const T2> values2)
+	{
+		return subtraction<T1, T1, T2>(values1, values2, values1);
+	}
+
+	/**
+	 * @brief Values1 * Values2 into a caller provided buffer. No allocation. See multiple().
+	 *
+     * @code{.cpp}
+     * std::vector<int> values1;
+     * std::vector<long> values2;
+	 * std::vector<double> result(values1.size());
+	 * bool success = Utils::multiple<double, int, long>(values1, values2, result);
+     * @endcode
+	 *
 	 * @tparam R Return Numerical type.
-	 * @tparam T Input Numerical type.
-	 * @param values Values to be calculated median.
-	 * @return T Return median
-     * @date 2021-03-17
-	 */
-	template <typename T>
-	T median(std::vector<T> values)
+	 * @tparam T1 Input Numerical type 1.
+	 * @tparam T2 Input Numerical type 2.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result. It can be the same buffer as values1 or values2.
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T1, typename T2>
+	bool multiple(std::span<const T1> values1, std::span<const T2> values2, std::span<R> result)
 	{
 		// Exception
-		if constexpr (!is_numerical<T>)
+		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
 			throw "This funciton only support numerical type.";
 
-		// Get size
-		size_t size = values.size();
-		if (size == 0) return 0;  // Undefined, really.
+		// Check size
+		if (values1.size() != values2.size() || values1.size() != result.size()) return false;
 
 		// Calculate
-		sort(values.begin(), values.end());
-		if (size % 2 == 0)
+		Detail::applyElementwise(ElementwiseOperator::Multiple, values1.data(), values2.data(), result.data(), result.size());
+
+		return true;
+	}
+
+	/**
+	 * @brief Values1 *= Values2. No allocation. See multiple().
+	 *
+     * @code{.cpp}
+     * std::vector<float> values1;
+     * std::vector<float> values2;
+	 * bool success = Utils::multipleInPlace<float, float>(values1, values2);
+     * @endcode
+	 *
+	 * @tparam T1 Numerical type 1.
+	 * @tparam T2 Numerical type 2.
+	 * @param[in, out] values1 Values 1 to be updated
+	 * @param[in] values2 Values 2
+	 * @return Return false if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename T1, typename T2>
+	bool multipleInPlace(std::span<T1> values1, std::span<const T2> values2)
+	{
+		return multiple<T1, T1, T2>(values1, values2, values1);
+	}
+
+	/**
+	 * @brief Output layout of divideBy() when a divisor is 0
+     * @date 2026-10-16
+	*/
+	enum class DivisionMode
+	{
+		Compact,	// Skip the quotient, so the result is shorter than the inputs
+		Aligned		// Write a fill value, so result[i] always belongs to values1[i] and values2[i]
+	};
+
+	/**
+	 * @brief Values1 / Values2 into a caller provided buffer. No allocation. See divideBy().
+	 * If R, T1 and T2 are the same float or double type, SIMD kernels are used. Compact mode uses compress-store on AVX-512
+	 * and a permutation table on AVX2.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values1;
+     * std::vector<float> values2;
+	 * std::vector<float> result(values1.size());
+	 *
+	 * // Skip zero divisors
+	 * size_t resultSize = Utils::divideBy<float, float, float>(values1, values2, result);
+	 *
+	 * // Keep result aligned with NaN and get the positions of zero divisors
+	 * Utils::BitMask zeroMask;
+	 * Utils::divideBy<float, float, float>(values1, values2, result, &zeroMask, Utils::DivisionMode::Aligned);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T1 Input Numerical type 1.
+	 * @tparam T2 Input Numerical type 2.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result. Its size must be the same as values1. It can be the same buffer as values1 or values2.
+	 * @param[out] zeroMask (Option) Bit i is set if values2[i] == 0. Default as NULL.
+	 * @param[in] mode (Option) Compact to skip zero divisors, Aligned to write fillValue. Default as Compact.
+	 * @param[in] fillValue (Option) Value written for zero divisors in Aligned mode. Default as NaN, or 0 for integer type.
+	 * @return Return the number of values written into result. Return 0 if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T1, typename T2>
+	size_t divideBy(std::span<const T1> values1, std::span<const T2> values2, std::span<R> result, BitMask* zeroMask = NULL,
+		DivisionMode mode = DivisionMode::Compact, R fillValue = std::numeric_limits<R>::quiet_NaN())
+	{
+		// Exception
+		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
+			throw "This funciton only support numerical type.";
+
+		// Check size
+		size_t size = values1.size();
+		if (values2.size() != size || result.size() != size) return 0;
+
+		// Initialize mask
+		uint64_t* zeroMaskWords = NULL;
+		if (zeroMask)
 		{
-			return (values[size / 2 - 1] + values[size / 2]) / 2;
+			zeroMask->assign(size);
+			zeroMaskWords = zeroMask->data();
 		}
-		else
+
+		// SIMD kernels
+		if constexpr (std::is_same_v<R, T1> && std::is_same_v<R, T2> && std::is_floating_point_v<R>)
 		{
-			return values[size / 2];
+			if (mode == DivisionMode::Compact)
+			{
+				return divideCompress(values1.data(), values2.data(), result.data(), size, zeroMaskWords);
+			}
+			else
+			{
+				divideAligned(values1.data(), values2.data(), result.data(), size, fillValue, zeroMaskWords);
+				return size;
+			}
 		}
-	};
 
-	// Math Operator
+		// Divide
+		size_t pushedCount = 0;
+		for (size_t i = 0; i < size; i++)
+		{
+			if (values2[i] != 0)
+			{
+				R quotient;
+				if constexpr (std::is_integral_v<R> && std::is_integral_v<T1> && std::is_integral_v<T2>)
+				{
+					using C = typename Detail::ElementwiseInteger<R, T1, T2>::type;
+					quotient = static_cast<R>((C)values1[i] / (C)values2[i]);
+				}
+				else
+					quotient = static_cast<R>((double)values1[i] / (double)values2[i]);
+				if (mode == DivisionMode::Compact)
+				{
+					result[pushedCount] = quotient;
+					pushedCount++;
+				}
+				else
+				{
+					result[i] = quotient;
+				}
+			}
+			else
+			{
+				if (mode == DivisionMode::Aligned) result[i] = fillValue;
+				if (zeroMask) zeroMask->set(i);
+			}
+		}
+
+		return mode == DivisionMode::Compact ? pushedCount : size;
+	}
 
 	/**
 	 * @brief Values1 + Values2.
+	 * SIMD kernels are used if R, T1 and T2 are the same type of uint8_t, int16_t, int32_t, float or double. Integer overflow wraps around.
 	 * 
      * @code{.cpp}
      * std::vector<int> values1;
@@ -155,7 +2369,7 @@ namespace Utils
      * @date 2021-03-17
 	*/
 	template <typename R, typename T1, typename T2>
-	std::vector<R> addition(std::vector<T1> values1, std::vector<T2> values2)
+	std::vector<R> addition(const std::vector<T1>& values1, const std::vector<T2>& values2)
 	{
 		// Exception
 		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
@@ -167,17 +2381,14 @@ namespace Utils
 
 		// Calculate
 		std::vector<R> result(size);
-		for (int i = 0; i < size; i++)
-		{
-			// Addition
-			result[i] = static_cast<R>((double)values1[i] + (double)values2[i]);
-		}
+		Detail::applyElementwise(ElementwiseOperator::Addition, values1.data(), values2.data(), result.data(), size);
 
 		return result;
 	}
 
 	/**
 	 * @brief Values1 - Values2.
+	 * SIMD kernels are used if R, T1 and T2 are the same type of uint8_t, int16_t, int32_t, float or double. Integer overflow wraps around.
 	 * 
      * @code{.cpp}
      * std::vector<int> values1;
@@ -194,7 +2405,7 @@ namespace Utils
      * @date 2021-03-17
 	*/
 	template <typename R, typename T1, typename T2 >
-	std::vector<R> subtraction(std::vector<T1> values1, std::vector<T2> values2)
+	std::vector<R> subtraction(const std::vector<T1>& values1, const std::vector<T2>& values2)
 	{
 		// Exception
 		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
@@ -206,17 +2417,14 @@ namespace Utils
 
 		// Calculate
 		std::vector<R> result(size);
-		for (int i = 0; i < size; i++)
-		{
-			// Subtraction
-			result[i] = static_cast<R>((double)values1[i] - (double)values2[i]);
-		}
+		Detail::applyElementwise(ElementwiseOperator::Subtraction, values1.data(), values2.data(), result.data(), size);
 
 		return result;
 	}
 
 	/**
 	 * @brief Values1 * Values2.
+	 * SIMD kernels are used if R, T1 and T2 are the same type of uint8_t, int16_t, int32_t, float or double. Integer overflow wraps around.
 	 * 
      * @code{.cpp}
      * std::vector<int> values1;
@@ -233,7 +2441,7 @@ namespace Utils
      * @date 2021-03-17
 	*/
 	template <typename R, typename T1, typename T2 >
-	std::vector<R> multiple(std::vector<T1> values1, std::vector<T2> values2)
+	std::vector<R> multiple(const std::vector<T1>& values1, const std::vector<T2>& values2)
 	{
 		// Exception
 		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
@@ -245,11 +2453,7 @@ namespace Utils
 
 		// Calculate
 		std::vector<R> result(size);
-		for (int i = 0; i < size; i++)
-		{
-			// Multiple
-			result[i] = static_cast<R>((double)values1[i] * (double)values2[i]);
-		}
+		Detail::applyElementwise(ElementwiseOperator::Multiple, values1.data(), values2.data(), result.data(), size);
 
 		return result;
 	}
@@ -273,7 +2477,7 @@ namespace Utils
      * @date 2021-03-17
 	*/
 	template <typename R, typename T1, typename T2 >
-	std::vector<R> divideBy(std::vector<T1> values1, std::vector<T2> values2, std::vector<int>* zeroIndices = NULL)
+	std::vector<R> divideBy(const std::vector<T1>& values1, const std::vector<T2>& values2, std::vector<int>* zeroIndices = NULL)
 	{
 		// Exception
 		if constexpr (!is_numerical<R> || !is_numerical<T1> || !is_numerical<T2>)
@@ -285,31 +2489,85 @@ namespace Utils
 		
 		// Calculate
 		std::vector<R> result(size);
-		size_t pushedCount = 0;
-		for (int i = 0; i < size; i++)
+		BitMask zeroMask;
+		size_t resultSize = divideBy<R, T1, T2>(values1, values2, result, zeroIndices ? &zeroMask : NULL);
+
+		// Zero indices
+		if (zeroIndices)
 		{
-			if (values2[i] != 0)
+			for (size_t i = 0; i < size; i++)
 			{
-				// Divide
-				result[pushedCount] = static_cast<R>((double)values1[i] / (double)values2[i]);
-
-				// Push zero
-				if (zeroIndices) zeroIndices->push_back(i);
-
-				// Move data point
-				pushedCount++;
-			}				
+				if (zeroMask.test(i)) zeroIndices->push_back((int)i);
+			}
 		}
 
 		// Resize
-		if (pushedCount != size) result.resize(pushedCount);
+		if (resultSize != size) result.resize(resultSize);
+
+		return result;
+	}
+
+	/**
+	 * @brief Values1 / Values2 with a bit mask of zero divisors. See divideBy(std::span, std::span, std::span, BitMask*, DivisionMode, R).
+	 *
+     * @code{.cpp}
+     * std::vector<double> values1;
+     * std::vector<double> values2;
+	 * Utils::BitMask zeroMask;
+	 * std::vector<double> result = Utils::divideBy<double>(values1, values2, &zeroMask, Utils::DivisionMode::Aligned, 0.0);
+     * @endcode
+	 *
+	 * @tparam R Return Numerical type.
+	 * @tparam T1 Input Numerical type 1.
+	 * @tparam T2 Input Numerical type 2.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] zeroMask Bit i is set if values2[i] == 0. It can be NULL.
+	 * @param[in] mode Compact to skip zero divisors, Aligned to write fillValue. It has no default so that divideBy(values1, values2, NULL) stays unambiguous.
+	 * @param[in] fillValue (Option) Value written for zero divisors in Aligned mode. Default as NaN, or 0 for integer type.
+	 * @return Return Values1 / Values2. Return empty vector if the sizes are not the same.
+     * @date 2026-10-16
+	*/
+	template <typename R, typename T1, typename T2>
+	std::vector<R> divideBy(const std::vector<T1>& values1, const std::vector<T2>& values2, BitMask* zeroMask,
+		DivisionMode mode, R fillValue = std::numeric_limits<R>::quiet_NaN())
+	{
+		if (values1.size() != values2.size()) return std::vector<R>();
+
+		std::vector<R> result(values1.size());
+		size_t resultSize = divideBy<R, T1, T2>(values1, values2, result, zeroMask, mode, fillValue);
+		if (resultSize != result.size()) result.resize(resultSize);
 
 		return result;
 	}
 
 	// Degree/Radius convertion
-	double toDegree(double radius);
-	double toRadius(double degree);
+
+	/**
+	 * @brief Convert radius to degree
+	 * @param radius Radius value
+	 * @return Return degree value
+     * @date 2021-03-17
+	*/
+	inline double toDegree(double radius)
+	{
+		return radius * (180.0 / PI);
+	}
+
+	/**
+	 * @brief Convert degree to radius
+	 * 
+	 * @param degree Degree value
+	 * @return Return radius value
+     * @date 2021-03-17
+	 */
+	inline double toRadius(double degree)
+	{
+		return degree * (PI / 180.0);
+	}
+
+	bool toDegree(std::span<const double> radius, std::span<double> degree);
+	bool toRadius(std::span<const double> degree, std::span<double> radius);
 }
 
 
@@ -199,13 +199,18 @@ namespace OpenCVUtils
 	 * @param[in, out] processContour The contour to be processed
 	 * @param[in] maxSpikeDistance The maximum distance of the spike
 	 * @param[in] maxSpikeAngle The maximum angle of the spike in degree
+	 * @param[in] useFastMath (Option) Use fastAcos() and fastRsqrt() for the angles. Default as false.
      * @date 2021-03-17
 	*/
-	void removeSpike(contour* processContour, double maxSpikeDistance, double maxSpikeAngle)
+	void removeSpike(contour* processContour, double maxSpikeDistance, double maxSpikeAngle, bool useFastMath)
 	{
 		int perviousContourSize = -1;
+		std::vector<double> angles;
 		while (perviousContourSize != processContour->size())
 		{
+			// Calculate angles
+			calculateAngles(*processContour, &angles, useFastMath);
+
 			// Find remove points
 			std::vector<int> removePoint;
 			int contourSize = processContour->size();
@@ -213,12 +218,11 @@ namespace OpenCVUtils
 			{
 				// Get points
 				cv::Point prePoint = (i == 0) ? processContour->at((size_t)(contourSize - 1)): processContour->at(i - 1);
-				cv::Point currentPoint = processContour->at(i);
 				cv::Point nextPoint = (i == contourSize - 1) ? processContour->at(0) : processContour->at((size_t)(i + 1));
 
-				// Calculate distance and angle
+				// Calculate distance
 				double distance = calculateDistance(prePoint, nextPoint);
-				double angle = calculateAngle(prePoint, currentPoint, nextPoint);
+				double angle = angles[i];
 
 				// Check remove point
 				if (distance <= maxSpikeDistance && angle > 0 && angle <= maxSpikeAngle)
@@ -233,24 +237,53 @@ namespace OpenCVUtils
 		}
 	}
 
+	/**
+	 * @brief Calculate the angle at every point of a closed contour, i.e. calculateAngle(points[i - 1], points[i], points[i + 1]).
+	 * @param[in] points The contour
+	 * @param[out] angles Angles in degree. It will be resized to the size of points, so the buffer can be reused.
+	 * @param[in] useFastMath (Option) Use fastAcos() and fastRsqrt(). Default as false.
+     * @date 2026-10-16
+	*/
+	void calculateAngles(const contour& points, std::vector<double>* angles, bool useFastMath)
+	{
+		size_t size = points.size();
+		angles->resize(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			const cv::Point& prePoint = points[i == 0 ? size - 1 : i - 1];
+			const cv::Point& nextPoint = points[i == size - 1 ? 0 : i + 1];
+			(*angles)[i] = calculateAngle(prePoint, points[i], nextPoint, useFastMath);
+		}
+	}
+
 	/**
 	 * @brief Calculate angle of vector1 (point2, point1) and vector2 (point2, point3)
 	 * @param[in] point1 Point 1
 	 * @param[in] point2 Point 2 
 	 * @param[in] point3 Point 3
-	 * @return Return angle in degree
+	 * @param[in] useFastMath (Option) Use fastAcos() and fastRsqrt(). The error is below 1e-5 degree, or below 1e-3 degree within 0.1 degree of 0 and 180. Default as false.
+	 * @return Return angle in degree. Return 0 if a vector has zero length.
      * @date 2021-03-17
 	*/
-	double calculateAngle(cv::Point point1, cv::Point point2, cv::Point point3)
+	double calculateAngle(cv::Point point1, cv::Point point2, cv::Point point3, bool useFastMath)
 	{
-		cv::Point vector1 = point2 - point1;
-		cv::Point vector2 = point2 - point3;
+		cv::Point2d vector1 = point2 - point1;
+		cv::Point2d vector2 = point2 - point3;
 
-		vector1 /= cv::norm(vector1);
-		vector2 /= cv::norm(vector2);
+		double squaredNorms = vector1.ddot(vector1) * vector2.ddot(vector2);
+		if (squaredNorms == 0) return 0;
 
 		double dotProduct = vector1.ddot(vector2);
-		double angle = Utils::toDegree(acos(dotProduct));
+		double angle;
+		if (useFastMath)
+		{
+			angle = Utils::toDegree(Utils::fastAcos(dotProduct * Utils::fastRsqrt(squaredNorms)));
+		}
+		else
+		{
+			double cosine = dotProduct / std::sqrt(squaredNorms);
+			angle = Utils::toDegree(acos(std::min(1.0, std::max(-1.0, cosine))));
+		}
 
 		return angle;
 	}
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <math_utils.h>
+#include <fast_math_utils.h>
 #include <general_utils.h>
 #include <color_utils.h>
 
@@ -31,10 +32,11 @@ namespace OpenCVUtils
 	// Contours
 	void removeContourTouchBoundary(contours* inputContours, int imageWidth, int imageHeight);
 	int getBiggestContourIndex(contours searchContours);
-	void removeSpike(contour* processContour, double maxSpikeDistance, double maxSpikeAngle);
+	void removeSpike(contour* processContour, double maxSpikeDistance, double maxSpikeAngle, bool useFastMath = false);
+	void calculateAngles(const contour& points, std::vector<double>* angles, bool useFastMath = false);
 
 	// Points
-	double calculateAngle(cv::Point point1, cv::Point point2, cv::Point point3);
+	double calculateAngle(cv::Point point1, cv::Point point2, cv::Point point3, bool useFastMath = false);
 	double calculateDistance(cv::Point point1, cv::Point point2);
 }
 
@@ -0,0 +1,974 @@
+#include <simd_utils.h>
+#include <atomic>
+#include <bit>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define JW_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only allow intrinsics in functions compiled for the instruction set. MSVC allows them everywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define JW_TARGET_SSE2 __attribute__((target("sse2")))
+#define JW_TARGET_AVX2 __attribute__((target("avx2")))
+#define JW_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#define JW_TARGET_SSE2
+#define JW_TARGET_AVX2
+#define JW_TARGET_AVX512
+#endif
+
+namespace Utils
+{
+	namespace   // anonymous namespace for private function
+	{
+#pragma region Scalar
+
+		/**
+		 * @brief Wider unsigned type used by the scalar integer operators, so that overflow wraps around instead of being undefined.
+		*/
+		template <typename T>
+		using WrapType = std::conditional_t<(sizeof(T) < 4), uint32_t, std::make_unsigned_t<T>>;
+
+		template <typename T>
+		inline T scalarAdd(T a, T b)
+		{
+			if constexpr (std::is_integral_v<T>) return static_cast<T>((WrapType<T>)a + (WrapType<T>)b);
+			else return a + b;
+		}
+
+		template <typename T>
+		inline T scalarSubtract(T a, T b)
+		{
+			if constexpr (std::is_integral_v<T>) return static_cast<T>((WrapType<T>)a - (WrapType<T>)b);
+			else return a - b;
+		}
+
+		template <typename T>
+		inline T scalarMultiple(T a, T b)
+		{
+			if constexpr (std::is_integral_v<T>) return static_cast<T>((WrapType<T>)a * (WrapType<T>)b);
+			else return a * b;
+		}
+
+		template <typename T>
+		inline T scalarDivide(T a, T b)
+		{
+			return a / b;
+		}
+
+		/**
+		 * @brief Kernel function of one type and one operator
+		*/
+		template <typename T>
+		using Kernel = void (*)(const T*, const T*, T*, size_t);
+
+		/**
+		 * @brief Kernels of one type and one instruction set. NULL if the operator is not supported.
+		*/
+		template <typename T>
+		struct KernelSet
+		{
+			Kernel<T> addition;
+			Kernel<T> subtraction;
+			Kernel<T> multiple;
+			Kernel<T> division;
+		};
+
+// Define a kernel with a vector body and a scalar tail
+#define JW_ELEMENTWISE_KERNEL(TARGET, NAME, TYPE, WIDTH, LOAD, STORE, VECTOR_OP, SCALAR_OP) \
+		TARGET void NAME(const TYPE* values1, const TYPE* values2, TYPE* result, size_t size) \
+		{ \
+			size_t i = 0; \
+			for (; i + (WIDTH) <= size; i += (WIDTH)) \
+			{ \
+				STORE(result + i, VECTOR_OP(LOAD(values1 + i), LOAD(values2 + i))); \
+			} \
+			for (; i < size; i++) \
+			{ \
+				result[i] = SCALAR_OP(values1[i], values2[i]); \
+			} \
+		}
+
+		template <typename T, T (*Op)(T, T)>
+		void scalarKernel(const T* values1, const T* values2, T* result, size_t size)
+		{
+			for (size_t i = 0; i < size; i++)
+			{
+				result[i] = Op(values1[i], values2[i]);
+			}
+		}
+
+		template <typename T>
+		KernelSet<T> scalarKernels()
+		{
+			KernelSet<T> kernels;
+			kernels.addition = scalarKernel<T, scalarAdd<T>>;
+			kernels.subtraction = scalarKernel<T, scalarSubtract<T>>;
+			kernels.multiple = scalarKernel<T, scalarMultiple<T>>;
+			kernels.division = std::is_floating_point_v<T> ? scalarKernel<T, scalarDivide<T>> : NULL;
+			return kernels;
+		}
+
+		/**
+		 * @brief Set the bits of zero divisors starting at index. The bits must not cross a 64-bit word.
+		*/
+		inline void setMaskBits(uint64_t* zeroMask, size_t index, uint64_t bits)
+		{
+			if (zeroMask) zeroMask[index >> 6] |= bits << (index & 63);
+		}
+
+		/**
+		 * @brief Scalar compacted division from index begin. Return the number of values written.
+		*/
+		template <typename T>
+		size_t divideCompressScalar(const T* values1, const T* values2, T* result, size_t begin, size_t size, size_t count, uint64_t* zeroMask)
+		{
+			for (size_t i = begin; i < size; i++)
+			{
+				if (values2[i] != 0)
+				{
+					result[count] = values1[i] / values2[i];
+					count++;
+				}
+				else
+				{
+					setMaskBits(zeroMask, i, 1);
+				}
+			}
+			return count;
+		}
+
+		/**
+		 * @brief Scalar aligned division from index begin
+		*/
+		template <typename T>
+		void divideAlignedScalar(const T* values1, const T* values2, T* result, size_t begin, size_t size, T fillValue, uint64_t* zeroMask)
+		{
+			for (size_t i = begin; i < size; i++)
+			{
+				if (values2[i] != 0)
+				{
+					result[i] = values1[i] / values2[i];
+				}
+				else
+				{
+					result[i] = fillValue;
+					setMaskBits(zeroMask, i, 1);
+				}
+			}
+		}
+
+		/**
+		 * @brief Best value and its index found by argExtreme
+		*/
+		struct ExtremeCandidate
+		{
+			double value = 0.0;
+			size_t index = 0;
+			bool found = false;
+		};
+
+		/**
+		 * @brief Replace the candidate if value is better, or equal with a smaller index. NaN is skipped.
+		*/
+		inline void mergeCandidate(ExtremeCandidate* best, double value, size_t index, bool findMax)
+		{
+			if (value != value) return;
+			if (!best->found || (findMax ? value > best->value : value < best->value) || (value == best->value && index < best->index))
+			{
+				best->value = value;
+				best->index = index;
+				best->found = true;
+			}
+		}
+
+		/**
+		 * @brief Scalar argmin or argmax from index begin
+		*/
+		template <typename T>
+		void argExtremeScalar(const T* values, size_t begin, size_t size, bool findMax, ExtremeCandidate* best, bool* hasNan)
+		{
+			for (size_t i = begin; i < size; i++)
+			{
+				if (values[i] != values[i]) *hasNan = true;
+				else mergeCandidate(best, values[i], i, findMax);
+			}
+		}
+
+#pragma endregion Scalar
+
+#ifdef JW_SIMD_X86
+
+#pragma region SSE2
+
+		JW_TARGET_SSE2 inline __m128i loadSse2(const void* p) { return _mm_loadu_si128((const __m128i*)p); }
+		JW_TARGET_SSE2 inline __m128 loadSse2(const float* p) { return _mm_loadu_ps(p); }
+		JW_TARGET_SSE2 inline __m128d loadSse2(const double* p) { return _mm_loadu_pd(p); }
+		JW_TARGET_SSE2 inline void storeSse2(void* p, __m128i v) { _mm_storeu_si128((__m128i*)p, v); }
+		JW_TARGET_SSE2 inline void storeSse2(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+		JW_TARGET_SSE2 inline void storeSse2(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+
+		/**
+		 * @brief 8-bit multiplication by multiplying the even and odd bytes in 16-bit lanes
+		*/
+		JW_TARGET_SSE2 inline __m128i mulU8Sse2(__m128i a, __m128i b)
+		{
+			__m128i even = _mm_mullo_epi16(a, b);
+			__m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+			return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
+		}
+
+		/**
+		 * @brief 32-bit multiplication without SSE4.1 _mm_mullo_epi32()
+		*/
+		JW_TARGET_SSE2 inline __m128i mulI32Sse2(__m128i a, __m128i b)
+		{
+			__m128i even = _mm_mul_epu32(a, b);
+			__m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+		}
+
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, addU8Sse2, uint8_t, 16, loadSse2, storeSse2, _mm_add_epi8, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, subU8Sse2, uint8_t, 16, loadSse2, storeSse2, _mm_sub_epi8, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, multU8Sse2, uint8_t, 16, loadSse2, storeSse2, mulU8Sse2, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, addI16Sse2, int16_t, 8, loadSse2, storeSse2, _mm_add_epi16, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, subI16Sse2, int16_t, 8, loadSse2, storeSse2, _mm_sub_epi16, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, multI16Sse2, int16_t, 8, loadSse2, storeSse2, _mm_mullo_epi16, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, addI32Sse2, int32_t, 4, loadSse2, storeSse2, _mm_add_epi32, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, subI32Sse2, int32_t, 4, loadSse2, storeSse2, _mm_sub_epi32, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, multI32Sse2, int32_t, 4, loadSse2, storeSse2, mulI32Sse2, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, addF32Sse2, float, 4, loadSse2, storeSse2, _mm_add_ps, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, subF32Sse2, float, 4, loadSse2, storeSse2, _mm_sub_ps, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, multF32Sse2, float, 4, loadSse2, storeSse2, _mm_mul_ps, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, divF32Sse2, float, 4, loadSse2, storeSse2, _mm_div_ps, scalarDivide)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, addF64Sse2, double, 2, loadSse2, storeSse2, _mm_add_pd, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, subF64Sse2, double, 2, loadSse2, storeSse2, _mm_sub_pd, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, multF64Sse2, double, 2, loadSse2, storeSse2, _mm_mul_pd, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_SSE2, divF64Sse2, double, 2, loadSse2, storeSse2, _mm_div_pd, scalarDivide)
+
+#pragma endregion SSE2
+
+#pragma region AVX2
+
+		JW_TARGET_AVX2 inline __m256i loadAvx2(const void* p) { return _mm256_loadu_si256((const __m256i*)p); }
+		JW_TARGET_AVX2 inline __m256 loadAvx2(const float* p) { return _mm256_loadu_ps(p); }
+		JW_TARGET_AVX2 inline __m256d loadAvx2(const double* p) { return _mm256_loadu_pd(p); }
+		JW_TARGET_AVX2 inline void storeAvx2(void* p, __m256i v) { _mm256_storeu_si256((__m256i*)p, v); }
+		JW_TARGET_AVX2 inline void storeAvx2(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+		JW_TARGET_AVX2 inline void storeAvx2(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+
+		JW_TARGET_AVX2 inline __m256i mulU8Avx2(__m256i a, __m256i b)
+		{
+			__m256i even = _mm256_mullo_epi16(a, b);
+			__m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+			return _mm256_or_si256(_mm256_slli_epi16(odd, 8), _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)));
+		}
+
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, addU8Avx2, uint8_t, 32, loadAvx2, storeAvx2, _mm256_add_epi8, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, subU8Avx2, uint8_t, 32, loadAvx2, storeAvx2, _mm256_sub_epi8, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, multU8Avx2, uint8_t, 32, loadAvx2, storeAvx2, mulU8Avx2, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, addI16Avx2, int16_t, 16, loadAvx2, storeAvx2, _mm256_add_epi16, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, subI16Avx2, int16_t, 16, loadAvx2, storeAvx2, _mm256_sub_epi16, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, multI16Avx2, int16_t, 16, loadAvx2, storeAvx2, _mm256_mullo_epi16, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, addI32Avx2, int32_t, 8, loadAvx2, storeAvx2, _mm256_add_epi32, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, subI32Avx2, int32_t, 8, loadAvx2, storeAvx2, _mm256_sub_epi32, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, multI32Avx2, int32_t, 8, loadAvx2, storeAvx2, _mm256_mullo_epi32, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, addF32Avx2, float, 8, loadAvx2, storeAvx2, _mm256_add_ps, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, subF32Avx2, float, 8, loadAvx2, storeAvx2, _mm256_sub_ps, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, multF32Avx2, float, 8, loadAvx2, storeAvx2, _mm256_mul_ps, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, divF32Avx2, float, 8, loadAvx2, storeAvx2, _mm256_div_ps, scalarDivide)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, addF64Avx2, double, 4, loadAvx2, storeAvx2, _mm256_add_pd, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, subF64Avx2, double, 4, loadAvx2, storeAvx2, _mm256_sub_pd, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, multF64Avx2, double, 4, loadAvx2, storeAvx2, _mm256_mul_pd, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX2, divF64Avx2, double, 4, loadAvx2, storeAvx2, _mm256_div_pd, scalarDivide)
+
+		/**
+		 * @brief Permutation indices which move the selected 32-bit lanes to the front, for the 8-bit mask of 8 floats
+		 * or the 4-bit mask of 4 doubles (two 32-bit lanes each).
+		*/
+		struct CompressTable
+		{
+			int32_t floatIndices[256][8];
+			int32_t doubleIndices[16][8];
+		};
+
+		constexpr CompressTable makeCompressTable()
+		{
+			CompressTable table = {};
+			for (int mask = 0; mask < 256; mask++)
+			{
+				int k = 0;
+				for (int lane = 0; lane < 8; lane++)
+				{
+					if ((mask >> lane) & 1) table.floatIndices[mask][k++] = lane;
+				}
+			}
+			for (int mask = 0; mask < 16; mask++)
+			{
+				int k = 0;
+				for (int lane = 0; lane < 4; lane++)
+				{
+					if ((mask >> lane) & 1)
+					{
+						table.doubleIndices[mask][k++] = 2 * lane;
+						table.doubleIndices[mask][k++] = 2 * lane + 1;
+					}
+				}
+			}
+			return table;
+		}
+
+		constexpr CompressTable COMPRESS_TABLE = makeCompressTable();
+
+		/**
+		 * @brief Compacted division. A full vector is stored at result + count, lanes after the compacted values are overwritten
+		 * but they are never after the values already loaded.
+		*/
+		JW_TARGET_AVX2 size_t divideCompressF32Avx2(const float* values1, const float* values2, float* result, size_t size, uint64_t* zeroMask)
+		{
+			size_t count = 0;
+			size_t i = 0;
+			__m256 zero = _mm256_setzero_ps();
+			for (; i + 8 <= size; i += 8)
+			{
+				__m256 divisor = _mm256_loadu_ps(values2 + i);
+				unsigned nonZero = (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(divisor, zero, _CMP_NEQ_UQ));
+				__m256 quotient = _mm256_div_ps(_mm256_loadu_ps(values1 + i), divisor);
+				__m256i permutation = _mm256_loadu_si256((const __m256i*)COMPRESS_TABLE.floatIndices[nonZero]);
+				_mm256_storeu_ps(result + count, _mm256_permutevar8x32_ps(quotient, permutation));
+				count += std::popcount(nonZero);
+				setMaskBits(zeroMask, i, ~nonZero & 0xFF);
+			}
+			return divideCompressScalar(values1, values2, result, i, size, count, zeroMask);
+		}
+
+		JW_TARGET_AVX2 size_t divideCompressF64Avx2(const double* values1, const double* values2, double* result, size_t size, uint64_t* zeroMask)
+		{
+			size_t count = 0;
+			size_t i = 0;
+			__m256d zero = _mm256_setzero_pd();
+			for (; i + 4 <= size; i += 4)
+			{
+				__m256d divisor = _mm256_loadu_pd(values2 + i);
+				unsigned nonZero = (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(divisor, zero, _CMP_NEQ_UQ));
+				__m256d quotient = _mm256_div_pd(_mm256_loadu_pd(values1 + i), divisor);
+				__m256i permutation = _mm256_loadu_si256((const __m256i*)COMPRESS_TABLE.doubleIndices[nonZero]);
+				__m256 packed = _mm256_permutevar8x32_ps(_mm256_castpd_ps(quotient), permutation);
+				_mm256_storeu_pd(result + count, _mm256_castps_pd(packed));
+				count += std::popcount(nonZero);
+				setMaskBits(zeroMask, i, ~nonZero & 0x0F);
+			}
+			return divideCompressScalar(values1, values2, result, i, size, count, zeroMask);
+		}
+
+		JW_TARGET_AVX2 void divideAlignedF32Avx2(const float* values1, const float* values2, float* result, size_t size, float fillValue, uint64_t* zeroMask)
+		{
+			size_t i = 0;
+			__m256 zero = _mm256_setzero_ps();
+			__m256 fill = _mm256_set1_ps(fillValue);
+			for (; i + 8 <= size; i += 8)
+			{
+				__m256 divisor = _mm256_loadu_ps(values2 + i);
+				__m256 nonZero = _mm256_cmp_ps(divisor, zero, _CMP_NEQ_UQ);
+				__m256 quotient = _mm256_div_ps(_mm256_loadu_ps(values1 + i), divisor);
+				_mm256_storeu_ps(result + i, _mm256_blendv_ps(fill, quotient, nonZero));
+				setMaskBits(zeroMask, i, ~(unsigned)_mm256_movemask_ps(nonZero) & 0xFF);
+			}
+			divideAlignedScalar(values1, values2, result, i, size, fillValue, zeroMask);
+		}
+
+		JW_TARGET_AVX2 void divideAlignedF64Avx2(const double* values1, const double* values2, double* result, size_t size, double fillValue, uint64_t* zeroMask)
+		{
+			size_t i = 0;
+			__m256d zero = _mm256_setzero_pd();
+			__m256d fill = _mm256_set1_pd(fillValue);
+			for (; i + 4 <= size; i += 4)
+			{
+				__m256d divisor = _mm256_loadu_pd(values2 + i);
+				__m256d nonZero = _mm256_cmp_pd(divisor, zero, _CMP_NEQ_UQ);
+				__m256d quotient = _mm256_div_pd(_mm256_loadu_pd(values1 + i), divisor);
+				_mm256_storeu_pd(result + i, _mm256_blendv_pd(fill, quotient, nonZero));
+				setMaskBits(zeroMask, i, ~(unsigned)_mm256_movemask_pd(nonZero) & 0x0F);
+			}
+			divideAlignedScalar(values1, values2, result, i, size, fillValue, zeroMask);
+		}
+
+		/**
+		 * @brief Argmin or argmax with the value and index of each lane. A lane is replaced if the value is better or the lane is still NaN,
+		 * so NaN is only kept by lanes without any number. Indices are 32-bit, so size must be less than 2^31.
+		*/
+		JW_TARGET_AVX2 void argExtremeF32Avx2(const float* values, size_t size, bool findMax, ExtremeCandidate* best, bool* hasNan)
+		{
+			size_t i = 0;
+			if (size >= 8)
+			{
+				__m256 bestValues = _mm256_loadu_ps(values);
+				__m256i bestIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+				__m256i indices = bestIndices;
+				__m256 nan = _mm256_cmp_ps(bestValues, bestValues, _CMP_UNORD_Q);
+				const __m256i step = _mm256_set1_epi32(8);
+				for (i = 8; i + 8 <= size; i += 8)
+				{
+					__m256 v = _mm256_loadu_ps(values + i);
+					indices = _mm256_add_epi32(indices, step);
+					nan = _mm256_or_ps(nan, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+					__m256 better = findMax ? _mm256_cmp_ps(v, bestValues, _CMP_GT_OQ) : _mm256_cmp_ps(v, bestValues, _CMP_LT_OQ);
+					better = _mm256_or_ps(better, _mm256_cmp_ps(bestValues, bestValues, _CMP_UNORD_Q));
+					bestValues = _mm256_blendv_ps(bestValues, v, better);
+					bestIndices = _mm256_blendv_epi8(bestIndices, indices, _mm256_castps_si256(better));
+				}
+
+				float laneValues[8];
+				int32_t laneIndices[8];
+				_mm256_storeu_ps(laneValues, bestValues);
+				_mm256_storeu_si256((__m256i*)laneIndices, bestIndices);
+				for (int lane = 0; lane < 8; lane++)
+				{
+					mergeCandidate(best, laneValues[lane], (size_t)laneIndices[lane], findMax);
+				}
+				if (_mm256_movemask_ps(nan) != 0) *hasNan = true;
+			}
+			argExtremeScalar(values, i, size, findMax, best, hasNan);
+		}
+
+		JW_TARGET_AVX2 void argExtremeF64Avx2(const double* values, size_t size, bool findMax, ExtremeCandidate* best, bool* hasNan)
+		{
+			size_t i = 0;
+			if (size >= 4)
+			{
+				__m256d bestValues = _mm256_loadu_pd(values);
+				__m256i bestIndices = _mm256_setr_epi64x(0, 1, 2, 3);
+				__m256i indices = bestIndices;
+				__m256d nan = _mm256_cmp_pd(bestValues, bestValues, _CMP_UNORD_Q);
+				const __m256i step = _mm256_set1_epi64x(4);
+				for (i = 4; i + 4 <= size; i += 4)
+				{
+					__m256d v = _mm256_loadu_pd(values + i);
+					indices = _mm256_add_epi64(indices, step);
+					nan = _mm256_or_pd(nan, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+					__m256d better = findMax ? _mm256_cmp_pd(v, bestValues, _CMP_GT_OQ) : _mm256_cmp_pd(v, bestValues, _CMP_LT_OQ);
+					better = _mm256_or_pd(better, _mm256_cmp_pd(bestValues, bestValues, _CMP_UNORD_Q));
+					bestValues = _mm256_blendv_pd(bestValues, v, better);
+					bestIndices = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(bestIndices), _mm256_castsi256_pd(indices), better));
+				}
+
+				double laneValues[4];
+				int64_t laneIndices[4];
+				_mm256_storeu_pd(laneValues, bestValues);
+				_mm256_storeu_si256((__m256i*)laneIndices, bestIndices);
+				for (int lane = 0; lane < 4; lane++)
+				{
+					mergeCandidate(best, laneValues[lane], (size_t)laneIndices[lane], findMax);
+				}
+				if (_mm256_movemask_pd(nan) != 0) *hasNan = true;
+			}
+			argExtremeScalar(values, i, size, findMax, best, hasNan);
+		}
+
+#pragma endregion AVX2
+
+#pragma region AVX512
+
+		JW_TARGET_AVX512 inline __m512i loadAvx512(const void* p) { return _mm512_loadu_si512(p); }
+		JW_TARGET_AVX512 inline __m512 loadAvx512(const float* p) { return _mm512_loadu_ps(p); }
+		JW_TARGET_AVX512 inline __m512d loadAvx512(const double* p) { return _mm512_loadu_pd(p); }
+		JW_TARGET_AVX512 inline void storeAvx512(void* p, __m512i v) { _mm512_storeu_si512(p, v); }
+		JW_TARGET_AVX512 inline void storeAvx512(float* p, __m512 v) { _mm512_storeu_ps(p, v); }
+		JW_TARGET_AVX512 inline void storeAvx512(double* p, __m512d v) { _mm512_storeu_pd(p, v); }
+
+		JW_TARGET_AVX512 inline __m512i mulU8Avx512(__m512i a, __m512i b)
+		{
+			__m512i even = _mm512_mullo_epi16(a, b);
+			__m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8));
+			return _mm512_or_si512(_mm512_slli_epi16(odd, 8), _mm512_and_si512(even, _mm512_set1_epi16(0x00FF)));
+		}
+
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, addU8Avx512, uint8_t, 64, loadAvx512, storeAvx512, _mm512_add_epi8, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, subU8Avx512, uint8_t, 64, loadAvx512, storeAvx512, _mm512_sub_epi8, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, multU8Avx512, uint8_t, 64, loadAvx512, storeAvx512, mulU8Avx512, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, addI16Avx512, int16_t, 32, loadAvx512, storeAvx512, _mm512_add_epi16, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, subI16Avx512, int16_t, 32, loadAvx512, storeAvx512, _mm512_sub_epi16, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, multI16Avx512, int16_t, 32, loadAvx512, storeAvx512, _mm512_mullo_epi16, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, addI32Avx512, int32_t, 16, loadAvx512, storeAvx512, _mm512_add_epi32, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, subI32Avx512, int32_t, 16, loadAvx512, storeAvx512, _mm512_sub_epi32, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, multI32Avx512, int32_t, 16, loadAvx512, storeAvx512, _mm512_mullo_epi32, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, addF32Avx512, float, 16, loadAvx512, storeAvx512, _mm512_add_ps, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, subF32Avx512, float, 16, loadAvx512, storeAvx512, _mm512_sub_ps, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, multF32Avx512, float, 16, loadAvx512, storeAvx512, _mm512_mul_ps, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, divF32Avx512, float, 16, loadAvx512, storeAvx512, _mm512_div_ps, scalarDivide)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, addF64Avx512, double, 8, loadAvx512, storeAvx512, _mm512_add_pd, scalarAdd)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, subF64Avx512, double, 8, loadAvx512, storeAvx512, _mm512_sub_pd, scalarSubtract)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, multF64Avx512, double, 8, loadAvx512, storeAvx512, _mm512_mul_pd, scalarMultiple)
+		JW_ELEMENTWISE_KERNEL(JW_TARGET_AVX512, divF64Avx512, double, 8, loadAvx512, storeAvx512, _mm512_div_pd, scalarDivide)
+
+		JW_TARGET_AVX512 size_t divideCompressF32Avx512(const float* values1, const float* values2, float* result, size_t size, uint64_t* zeroMask)
+		{
+			size_t count = 0;
+			size_t i = 0;
+			__m512 zero = _mm512_setzero_ps();
+			for (; i + 16 <= size; i += 16)
+			{
+				__m512 divisor = _mm512_loadu_ps(values2 + i);
+				__mmask16 nonZero = _mm512_cmp_ps_mask(divisor, zero, _CMP_NEQ_UQ);
+				__m512 quotient = _mm512_maskz_div_ps(nonZero, _mm512_loadu_ps(values1 + i), divisor);
+				_mm512_mask_compressstoreu_ps(result + count, nonZero, quotient);
+				count += std::popcount((unsigned)nonZero);
+				setMaskBits(zeroMask, i, ~(unsigned)nonZero & 0xFFFF);
+			}
+			return divideCompressScalar(values1, values2, result, i, size, count, zeroMask);
+		}
+
+		JW_TARGET_AVX512 size_t divideCompressF64Avx512(const double* values1, const double* values2, double* result, size_t size, uint64_t* zeroMask)
+		{
+			size_t count = 0;
+			size_t i = 0;
+			__m512d zero = _mm512_setzero_pd();
+			for (; i + 8 <= size; i += 8)
+			{
+				__m512d divisor = _mm512_loadu_pd(values2 + i);
+				__mmask8 nonZero = _mm512_cmp_pd_mask(divisor, zero, _CMP_NEQ_UQ);
+				__m512d quotient = _mm512_maskz_div_pd(nonZero, _mm512_loadu_pd(values1 + i), divisor);
+				_mm512_mask_compressstoreu_pd(result + count, nonZero, quotient);
+				count += std::popcount((unsigned)nonZero);
+				setMaskBits(zeroMask, i, ~(unsigned)nonZero & 0xFF);
+			}
+			return divideCompressScalar(values1, values2, result, i, size, count, zeroMask);
+		}
+
+		JW_TARGET_AVX512 void divideAlignedF32Avx512(const float* values1, const float* values2, float* result, size_t size, float fillValue, uint64_t* zeroMask)
+		{
+			size_t i = 0;
+			__m512 zero = _mm512_setzero_ps();
+			__m512 fill = _mm512_set1_ps(fillValue);
+			for (; i + 16 <= size; i += 16)
+			{
+				__m512 divisor = _mm512_loadu_ps(values2 + i);
+				__mmask16 nonZero = _mm512_cmp_ps_mask(divisor, zero, _CMP_NEQ_UQ);
+				_mm512_storeu_ps(result + i, _mm512_mask_div_ps(fill, nonZero, _mm512_loadu_ps(values1 + i), divisor));
+				setMaskBits(zeroMask, i, ~(unsigned)nonZero & 0xFFFF);
+			}
+			divideAlignedScalar(values1, values2, result, i, size, fillValue, zeroMask);
+		}
+
+		JW_TARGET_AVX512 void divideAlignedF64Avx512(const double* values1, const double* values2, double* result, size_t size, double fillValue, uint64_t* zeroMask)
+		{
+			size_t i = 0;
+			__m512d zero = _mm512_setzero_pd();
+			__m512d fill = _mm512_set1_pd(fillValue);
+			for (; i + 8 <= size; i += 8)
+			{
+				__m512d divisor = _mm512_loadu_pd(values2 + i);
+				__mmask8 nonZero = _mm512_cmp_pd_mask(divisor, zero, _CMP_NEQ_UQ);
+				_mm512_storeu_pd(result + i, _mm512_mask_div_pd(fill, nonZero, _mm512_loadu_pd(values1 + i), divisor));
+				setMaskBits(zeroMask, i, ~(unsigned)nonZero & 0xFF);
+			}
+			divideAlignedScalar(values1, values2, result, i, size, fillValue, zeroMask);
+		}
+
+		/**
+		 * @brief Argmin or argmax with masked moves. See argExtremeF32Avx2().
+		*/
+		JW_TARGET_AVX512 void argExtremeF32Avx512(const float* values, size_t size, bool findMax, ExtremeCandidate* best, bool* hasNan)
+		{
+			size_t i = 0;
+			if (size >= 16)
+			{
+				__m512 bestValues = _mm512_loadu_ps(values);
+				__m512i bestIndices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+				__m512i indices = bestIndices;
+				__mmask16 nan = _mm512_cmp_ps_mask(bestValues, bestValues, _CMP_UNORD_Q);
+				const __m512i step = _mm512_set1_epi32(16);
+				for (i = 16; i + 16 <= size; i += 16)
+				{
+					__m512 v = _mm512_loadu_ps(values + i);
+					indices = _mm512_add_epi32(indices, step);
+					nan |= _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+					__mmask16 better = findMax ? _mm512_cmp_ps_mask(v, bestValues, _CMP_GT_OQ) : _mm512_cmp_ps_mask(v, bestValues, _CMP_LT_OQ);
+					better |= _mm512_cmp_ps_mask(bestValues, bestValues, _CMP_UNORD_Q);
+					bestValues = _mm512_mask_mov_ps(bestValues, better, v);
+					bestIndices = _mm512_mask_mov_epi32(bestIndices, better, indices);
+				}
+
+				float laneValues[16];
+				int32_t laneIndices[16];
+				_mm512_storeu_ps(laneValues, bestValues);
+				_mm512_storeu_si512(laneIndices, bestIndices);
+				for (int lane = 0; lane < 16; lane++)
+				{
+					mergeCandidate(best, laneValues[lane], (size_t)laneIndices[lane], findMax);
+				}
+				if (nan != 0) *hasNan = true;
+			}
+			argExtremeScalar(values, i, size, findMax, best, hasNan);
+		}
+
+		JW_TARGET_AVX512 void argExtremeF64Avx512(const double* values, size_t size, bool findMax, ExtremeCandidate* best, bool* hasNan)
+		{
+			size_t i = 0;
+			if (size >= 8)
+			{
+				__m512d bestValues = _mm512_loadu_pd(values);
+				__m512i bestIndices = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+				__m512i indices = bestIndices;
+				__mmask8 nan = _mm512_cmp_pd_mask(bestValues, bestValues, _CMP_UNORD_Q);
+				const __m512i step = _mm512_set1_epi64(8);
+				for (i = 8; i + 8 <= size; i += 8)
+				{
+					__m512d v = _mm512_loadu_pd(values + i);
+					indices = _mm512_add_epi64(indices, step);
+					nan |= _mm512_cmp_pd_mask(v, v, _CMP_UNORD_Q);
+					__mmask8 better = findMax ? _mm512_cmp_pd_mask(v, bestValues, _CMP_GT_OQ) : _mm512_cmp_pd_mask(v, bestValues, _CMP_LT_OQ);
+					better |= _mm512_cmp_pd_mask(bestValues, bestValues, _CMP_UNORD_Q);
+					bestValues = _mm512_mask_mov_pd(bestValues, better, v);
+					bestIndices = _mm512_mask_mov_epi64(bestIndices, better, indices);
+				}
+
+				double laneValues[8];
+				int64_t laneIndices[8];
+				_mm512_storeu_pd(laneValues, bestValues);
+				_mm512_storeu_si512(laneIndices, bestIndices);
+				for (int lane = 0; lane < 8; lane++)
+				{
+					mergeCandidate(best, laneValues[lane], (size_t)laneIndices[lane], findMax);
+				}
+				if (nan != 0) *hasNan = true;
+			}
+			argExtremeScalar(values, i, size, findMax, best, hasNan);
+		}
+
+#pragma endregion AVX512
+
+#endif
+
+		/**
+		 * @brief Get the kernels of the type for the current instruction set
+		*/
+		template <typename T>
+		KernelSet<T> getKernels(SimdLevel level)
+		{
+#ifdef JW_SIMD_X86
+			if constexpr (std::is_same_v<T, uint8_t>)
+			{
+				if (level == SimdLevel::AVX512) return { addU8Avx512, subU8Avx512, multU8Avx512, NULL };
+				if (level == SimdLevel::AVX2) return { addU8Avx2, subU8Avx2, multU8Avx2, NULL };
+				if (level == SimdLevel::SSE2) return { addU8Sse2, subU8Sse2, multU8Sse2, NULL };
+			}
+			else if constexpr (std::is_same_v<T, int16_t>)
+			{
+				if (level == SimdLevel::AVX512) return { addI16Avx512, subI16Avx512, multI16Avx512, NULL };
+				if (level == SimdLevel::AVX2) return { addI16Avx2, subI16Avx2, multI16Avx2, NULL };
+				if (level == SimdLevel::SSE2) return { addI16Sse2, subI16Sse2, multI16Sse2, NULL };
+			}
+			else if constexpr (std::is_same_v<T, int32_t>)
+			{
+				if (level == SimdLevel::AVX512) return { addI32Avx512, subI32Avx512, multI32Avx512, NULL };
+				if (level == SimdLevel::AVX2) return { addI32Avx2, subI32Avx2, multI32Avx2, NULL };
+				if (level == SimdLevel::SSE2) return { addI32Sse2, subI32Sse2, multI32Sse2, NULL };
+			}
+			else if constexpr (std::is_same_v<T, float>)
+			{
+				if (level == SimdLevel::AVX512) return { addF32Avx512, subF32Avx512, multF32Avx512, divF32Avx512 };
+				if (level == SimdLevel::AVX2) return { addF32Avx2, subF32Avx2, multF32Avx2, divF32Avx2 };
+				if (level == SimdLevel::SSE2) return { addF32Sse2, subF32Sse2, multF32Sse2, divF32Sse2 };
+			}
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				if (level == SimdLevel::AVX512) return { addF64Avx512, subF64Avx512, multF64Avx512, divF64Avx512 };
+				if (level == SimdLevel::AVX2) return { addF64Avx2, subF64Avx2, multF64Avx2, divF64Avx2 };
+				if (level == SimdLevel::SSE2) return { addF64Sse2, subF64Sse2, multF64Sse2, divF64Sse2 };
+			}
+#endif
+			return scalarKernels<T>();
+		}
+
+		/**
+		 * @brief Run the kernel of the operator
+		*/
+		template <typename T>
+		bool runKernel(ElementwiseOperator op, const T* values1, const T* values2, T* result, size_t size)
+		{
+			KernelSet<T> kernels = getKernels<T>(getSimdLevel());
+
+			Kernel<T> kernel = NULL;
+			switch (op)
+			{
+			case ElementwiseOperator::Addition: kernel = kernels.addition; break;
+			case ElementwiseOperator::Subtraction: kernel = kernels.subtraction; break;
+			case ElementwiseOperator::Multiple: kernel = kernels.multiple; break;
+			case ElementwiseOperator::Division: kernel = kernels.division; break;
+			}
+			if (!kernel) return false;
+
+			kernel(values1, values2, result, size);
+			return true;
+		}
+
+		/**
+		 * @brief Detect the instruction set supported by both CPU and OS
+		*/
+		SimdLevel detectSimdLevel()
+		{
+#ifdef JW_SIMD_X86
+#ifdef _MSC_VER
+			int info[4];
+			__cpuid(info, 0);
+			int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			bool sse2 = (info[3] & (1 << 26)) != 0;
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+
+			// Check whether OS saves the YMM and ZMM registers
+			unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+			bool ymmEnabled = (xcr0 & 0x06) == 0x06;
+			bool zmmEnabled = (xcr0 & 0xE6) == 0xE6;
+
+			bool avx2 = false;
+			bool avx512 = false;
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = avx && ymmEnabled && (info[1] & (1 << 5)) != 0;
+				avx512 = zmmEnabled && (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0;
+			}
+#else
+			__builtin_cpu_init();
+			bool sse2 = __builtin_cpu_supports("sse2");
+			bool avx2 = __builtin_cpu_supports("avx2");
+			bool avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+			if (avx512 && avx2) return SimdLevel::AVX512;
+			if (avx2) return SimdLevel::AVX2;
+			if (sse2) return SimdLevel::SSE2;
+#endif
+			return SimdLevel::Scalar;
+		}
+
+		/**
+		 * @brief Current instruction set. -1 if not yet detected.
+		*/
+		std::atomic<int> g_simdLevel = -1;
+	}
+
+#pragma region Instruction set
+
+	/**
+	 * @brief Get the best instruction set supported by the CPU and OS. It is detected once by CPUID.
+	 * @return Return the supported instruction set.
+	 * @date 2026-10-16
+	*/
+	SimdLevel getSupportedSimdLevel()
+	{
+		static const SimdLevel supportedLevel = detectSimdLevel();
+		return supportedLevel;
+	}
+
+	/**
+	 * @brief Get the instruction set used by the SIMD kernels. Default as getSupportedSimdLevel().
+	 * @return Return the instruction set in use.
+	 * @date 2026-10-16
+	*/
+	SimdLevel getSimdLevel()
+	{
+		int level = g_simdLevel.load(std::memory_order_relaxed);
+		if (level < 0)
+		{
+			level = (int)getSupportedSimdLevel();
+			g_simdLevel.store(level, std::memory_order_relaxed);
+		}
+		return (SimdLevel)level;
+	}
+
+	/**
+	 * @brief Limit the instruction set used by the SIMD kernels, e.g. for benchmarking or comparing with the scalar path.
+	 * @param level Instruction set. It will be lowered to getSupportedSimdLevel() if the CPU does not support it.
+	 * @date 2026-10-16
+	*/
+	void setSimdLevel(SimdLevel level)
+	{
+		if ((int)level > (int)getSupportedSimdLevel()) level = getSupportedSimdLevel();
+		g_simdLevel.store((int)level, std::memory_order_relaxed);
+	}
+
+#pragma endregion Instruction set
+
+#pragma region Elementwise
+
+	/**
+	 * @brief Elementwise operation, result[i] = values1[i] op values2[i]. Integer overflow wraps around.
+	 *
+	 * @code{.cpp}
+	 * std::vector<float> values1, values2, result;
+	 * Utils::elementwise(Utils::ElementwiseOperator::Addition, values1.data(), values2.data(), result.data(), result.size());
+	 * @endcode
+	 *
+	 * @param[in] op Operator. Division only support float and double.
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result. It can be the same as values1 or values2.
+	 * @param[in] size Number of values
+	 * @return Return false if the operator is not supported by the type.
+	 * @date 2026-10-16
+	*/
+	bool elementwise(ElementwiseOperator op, const uint8_t* values1, const uint8_t* values2, uint8_t* result, size_t size)
+	{
+		return runKernel(op, values1, values2, result, size);
+	}
+
+	bool elementwise(ElementwiseOperator op, const int16_t* values1, const int16_t* values2, int16_t* result, size_t size)
+	{
+		return runKernel(op, values1, values2, result, size);
+	}
+
+	bool elementwise(ElementwiseOperator op, const int32_t* values1, const int32_t* values2, int32_t* result, size_t size)
+	{
+		return runKernel(op, values1, values2, result, size);
+	}
+
+	bool elementwise(ElementwiseOperator op, const float* values1, const float* values2, float* result, size_t size)
+	{
+		return runKernel(op, values1, values2, result, size);
+	}
+
+	bool elementwise(ElementwiseOperator op, const double* values1, const double* values2, double* result, size_t size)
+	{
+		return runKernel(op, values1, values2, result, size);
+	}
+
+#pragma endregion Elementwise
+
+#pragma region Masked division
+
+	/**
+	 * @brief Compacted division, result[k] = values1[i] / values2[i] for each values2[i] != 0 in order.
+	 * AVX-512 uses compress-store, AVX2 uses a permutation table, others use scalar loop.
+	 *
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result with at least size elements. It can be the same buffer as values1 or values2.
+	 * @param[in] size Number of values
+	 * @param[in, out] zeroMask (Option) Words of a bit mask with at least size bits, all bits must be 0. Bit i will be set if values2[i] == 0. It can be NULL.
+	 * @return Return the number of values written into result.
+	 * @date 2026-10-16
+	*/
+	size_t divideCompress(const float* values1, const float* values2, float* result, size_t size, uint64_t* zeroMask)
+	{
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512) return divideCompressF32Avx512(values1, values2, result, size, zeroMask);
+		if (level == SimdLevel::AVX2) return divideCompressF32Avx2(values1, values2, result, size, zeroMask);
+#endif
+		return divideCompressScalar(values1, values2, result, 0, size, 0, zeroMask);
+	}
+
+	size_t divideCompress(const double* values1, const double* values2, double* result, size_t size, uint64_t* zeroMask)
+	{
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512) return divideCompressF64Avx512(values1, values2, result, size, zeroMask);
+		if (level == SimdLevel::AVX2) return divideCompressF64Avx2(values1, values2, result, size, zeroMask);
+#endif
+		return divideCompressScalar(values1, values2, result, 0, size, 0, zeroMask);
+	}
+
+	/**
+	 * @brief Aligned division, result[i] = values1[i] / values2[i], or fillValue if values2[i] == 0.
+	 *
+	 * @param[in] values1 Values 1
+	 * @param[in] values2 Values 2
+	 * @param[out] result Result with at least size elements. It can be the same buffer as values1 or values2.
+	 * @param[in] size Number of values
+	 * @param[in] fillValue Value of result[i] if values2[i] == 0
+	 * @param[in, out] zeroMask (Option) Words of a bit mask with at least size bits, all bits must be 0. Bit i will be set if values2[i] == 0. It can be NULL.
+	 * @date 2026-10-16
+	*/
+	void divideAligned(const float* values1, const float* values2, float* result, size_t size, float fillValue, uint64_t* zeroMask)
+	{
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512) return divideAlignedF32Avx512(values1, values2, result, size, fillValue, zeroMask);
+		if (level == SimdLevel::AVX2) return divideAlignedF32Avx2(values1, values2, result, size, fillValue, zeroMask);
+#endif
+		divideAlignedScalar(values1, values2, result, 0, size, fillValue, zeroMask);
+	}
+
+	void divideAligned(const double* values1, const double* values2, double* result, size_t size, double fillValue, uint64_t* zeroMask)
+	{
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512) return divideAlignedF64Avx512(values1, values2, result, size, fillValue, zeroMask);
+		if (level == SimdLevel::AVX2) return divideAlignedF64Avx2(values1, values2, result, size, fillValue, zeroMask);
+#endif
+		divideAlignedScalar(values1, values2, result, 0, size, fillValue, zeroMask);
+	}
+
+#pragma endregion Masked division
+
+#pragma region Min and max
+
+	/**
+	 * @brief Index of the minimum or maximum value in one pass, tracking the best value and index of each SIMD lane.
+	 * NaN is skipped. If several values are equal to the extreme, the first index is returned.
+	 *
+	 * @param[in] values Values
+	 * @param[in] size Number of values
+	 * @param[in] findMax Find the maximum if true, otherwise the minimum.
+	 * @param[out] hasNan (Option) Set as true if any value is NaN. It can be NULL.
+	 * @return Return the index. Return size if size is 0 or all values are NaN.
+	 * @date 2026-10-16
+	*/
+	size_t argExtreme(const float* values, size_t size, bool findMax, bool* hasNan)
+	{
+		ExtremeCandidate best;
+		bool nan = false;
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512 || level == SimdLevel::AVX2)
+		{
+			// 32-bit lane indices, so run by chunks
+			const size_t CHUNK_SIZE = (size_t)1 << 30;
+			for (size_t begin = 0; begin < size; begin += CHUNK_SIZE)
+			{
+				ExtremeCandidate chunkBest;
+				size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+				if (level == SimdLevel::AVX512) argExtremeF32Avx512(values + begin, chunkSize, findMax, &chunkBest, &nan);
+				else argExtremeF32Avx2(values + begin, chunkSize, findMax, &chunkBest, &nan);
+				if (chunkBest.found) mergeCandidate(&best, chunkBest.value, begin + chunkBest.index, findMax);
+			}
+		}
+		else
+#endif
+		{
+			argExtremeScalar(values, 0, size, findMax, &best, &nan);
+		}
+
+		if (hasNan != NULL) *hasNan = nan;
+		return best.found ? best.index : size;
+	}
+
+	size_t argExtreme(const double* values, size_t size, bool findMax, bool* hasNan)
+	{
+		ExtremeCandidate best;
+		bool nan = false;
+#ifdef JW_SIMD_X86
+		SimdLevel level = getSimdLevel();
+		if (level == SimdLevel::AVX512) argExtremeF64Avx512(values, size, findMax, &best, &nan);
+		else if (level == SimdLevel::AVX2) argExtremeF64Avx2(values, size, findMax, &best, &nan);
+		else
+#endif
+		{
+			argExtremeScalar(values, 0, size, findMax, &best, &nan);
+		}
+
+		if (hasNan != NULL) *hasNan = nan;
+		return best.found ? best.index : size;
+	}
+
+#pragma endregion Min and max
+}
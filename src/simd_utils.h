@@ -0,0 +1,71 @@
+#pragma once
+#ifndef JW_SIMD_UTILS_H
+#define JW_SIMD_UTILS_H
+
+//************Content************
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Utils
+{
+	/**
+	 * @brief Instruction set used by the SIMD kernels. AVX512 requires both AVX-512F and AVX-512BW.
+     * @date 2026-10-16
+	*/
+	enum class SimdLevel
+	{
+		Scalar = 0,
+		SSE2 = 1,
+		AVX2 = 2,
+		AVX512 = 3
+	};
+
+	/**
+	 * @brief Elementwise operator of the SIMD kernels
+     * @date 2026-10-16
+	*/
+	enum class ElementwiseOperator
+	{
+		Addition,
+		Subtraction,
+		Multiple,
+		Division
+	};
+
+	/**
+	 * @brief Check whether typename has SIMD elementwise kernels, i.e. uint8_t, int16_t, int32_t, float or double.
+	 * @tparam T Type to be checked.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	constexpr bool is_simd_type = std::is_same_v<T, uint8_t> || std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t> ||
+		std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	// ******Instruction set******
+	SimdLevel getSupportedSimdLevel();
+	SimdLevel getSimdLevel();
+	void setSimdLevel(SimdLevel level);
+
+	// ******Elementwise******
+	bool elementwise(ElementwiseOperator op, const uint8_t* values1, const uint8_t* values2, uint8_t* result, size_t size);
+	bool elementwise(ElementwiseOperator op, const int16_t* values1, const int16_t* values2, int16_t* result, size_t size);
+	bool elementwise(ElementwiseOperator op, const int32_t* values1, const int32_t* values2, int32_t* result, size_t size);
+	bool elementwise(ElementwiseOperator op, const float* values1, const float* values2, float* result, size_t size);
+	bool elementwise(ElementwiseOperator op, const double* values1, const double* values2, double* result, size_t size);
+
+	// ******Masked division******
+	size_t divideCompress(const float* values1, const float* values2, float* result, size_t size, uint64_t* zeroMask);
+	size_t divideCompress(const double* values1, const double* values2, double* result, size_t size, uint64_t* zeroMask);
+	void divideAligned(const float* values1, const float* values2, float* result, size_t size, float fillValue, uint64_t* zeroMask);
+	void divideAligned(const double* values1, const double* values2, double* result, size_t size, double fillValue, uint64_t* zeroMask);
+
+	// ******Min and max******
+	size_t argExtreme(const float* values, size_t size, bool findMax, bool* hasNan);
+	size_t argExtreme(const double* values, size_t size, bool findMax, bool* hasNan);
+}
+
+
+//*******************************
+
+#endif
@@ -0,0 +1,486 @@
+#pragma once
+#ifndef JW_SORT_UTILS_H
+#define JW_SORT_UTILS_H
+
+//************Content************
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <functional>
+#include <thread>
+#include <thread_utils.h>
+
+namespace Utils
+{
+	/**
+	 * @brief Check whether typename can be sorted by radix sort, i.e. integer (except bool), float or double.
+	 * @tparam T Type to be checked.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	constexpr bool is_radix_type = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Inputs smaller than this are sorted by std::sort, which is faster than the radix passes.
+		*/
+		constexpr size_t RADIX_SORT_MIN_SIZE = 256;
+
+		/**
+		 * @brief Unsigned integer of the same size as T
+		*/
+		template <typename T>
+		using RadixKey = std::conditional_t<sizeof(T) == 1, uint8_t, std::conditional_t<sizeof(T) == 2, uint16_t,
+			std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+		/**
+		 * @brief Map value into an unsigned key with the same order. The sign bit of signed integers is flipped.
+		 * Negative floating point values flip all bits and positive ones flip the sign bit (IEEE 754 order).
+		 * @date 2026-10-16
+		*/
+		template <typename T>
+		inline RadixKey<T> radixKey(T value)
+		{
+			using K = RadixKey<T>;
+			constexpr K SIGN_BIT = (K)((K)1 << (sizeof(K) * 8 - 1));
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				K bits = std::bit_cast<K>(value);
+				return (bits & SIGN_BIT) ? (K)~bits : (K)(bits | SIGN_BIT);
+			}
+			else if constexpr (std::is_signed_v<T>)
+			{
+				return (K)((K)value ^ SIGN_BIT);
+			}
+			else
+			{
+				return (K)value;
+			}
+		}
+
+		/**
+		 * @brief Count the digits of all bytes of the keys in one pass
+		 * @return Return true for each byte which is not the same for all keys, i.e. the pass is needed.
+		 * @date 2026-10-16
+		*/
+		template <typename T>
+		void radixHistogram(const T* values, size_t size, std::vector<size_t>* counts, bool* passNeeded)
+		{
+			constexpr size_t BYTES = sizeof(T);
+			counts->assign(BYTES * 256, 0);
+			size_t* count = counts->data();
+			for (size_t i = 0; i < size; i++)
+			{
+				RadixKey<T> key = radixKey(values[i]);
+				for (size_t byte = 0; byte < BYTES; byte++)
+				{
+					count[byte * 256 + ((key >> (byte * 8)) & 0xFF)]++;
+				}
+			}
+
+			for (size_t byte = 0; byte < BYTES; byte++)
+			{
+				passNeeded[byte] = count[byte * 256 + ((radixKey(values[0]) >> (byte * 8)) & 0xFF)] != size;
+			}
+		}
+
+		/**
+		 * @brief Turn the counts of one byte into the start position of each digit
+		 * @date 2026-10-16
+		*/
+		inline void radixOffsets(size_t* count)
+		{
+			size_t offset = 0;
+			for (size_t digit = 0; digit < 256; digit++)
+			{
+				size_t digitCount = count[digit];
+				count[digit] = offset;
+				offset += digitCount;
+			}
+		}
+	}
+
+	/**
+	 * @brief Stable LSD radix sort in ascending order, one pass per byte of the key. Passes are skipped if all values have the same byte,
+	 * and 8-bit values are sorted by counting. It is several times faster than std::sort on large integer, float and double arrays.
+	 * Negative zero is sorted before zero. NaN with the sign bit is sorted before -inf, and other NaN after inf.
+	 *
+     * @code{.cpp}
+     * std::vector<float> values;
+	 * Utils::radixSort(std::span<float>(values));
+	 *
+	 * // Reuse the buffer between calls to avoid allocation
+	 * std::vector<uint16_t> buffer;
+	 * Utils::radixSort(std::span<uint16_t>(pixels), &buffer);
+     * @endcode
+	 *
+	 * @tparam T Integer, float or double.
+	 * @param[in, out] values Values to be sorted.
+	 * @param[in, out] buffer (Option) Scratch buffer. Its content will be overwritten. Default as NULL to allocate a temporary buffer.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	void radixSort(std::span<T> values, std::vector<T>* buffer = NULL)
+	{
+		static_assert(is_radix_type<T>, "radixSort only support integer, float and double.");
+
+		size_t size = values.size();
+		if (size < Detail::RADIX_SORT_MIN_SIZE)
+		{
+			std::sort(values.begin(), values.end(), [](T a, T b) { return Detail::radixKey(a) < Detail::radixKey(b); });
+			return;
+		}
+
+		// Counting sort
+		if constexpr (sizeof(T) == 1)
+		{
+			size_t count[256] = { 0 };
+			for (size_t i = 0; i < size; i++)
+			{
+				count[Detail::radixKey(values[i])]++;
+			}
+			size_t i = 0;
+			for (size_t key = 0; key < 256; key++)
+			{
+				// The key of 8-bit values is the value with the sign bit flipped
+				T value = (T)(uint8_t)(std::is_signed_v<T> ? key ^ 0x80 : key);
+				std::fill(values.begin() + i, values.begin() + i + count[key], value);
+				i += count[key];
+			}
+			return;
+		}
+		else
+		{
+			constexpr size_t BYTES = sizeof(T);
+			std::vector<size_t> counts;
+			bool passNeeded[BYTES];
+			Detail::radixHistogram(values.data(), size, &counts, passNeeded);
+
+			std::vector<T> localBuffer;
+			std::vector<T>* scratch = buffer != NULL ? buffer : &localBuffer;
+			scratch->resize(size);
+
+			// Ping-pong between values and scratch
+			T* source = values.data();
+			T* target = scratch->data();
+			for (size_t byte = 0; byte < BYTES; byte++)
+			{
+				if (!passNeeded[byte]) continue;
+
+				size_t* offset = counts.data() + byte * 256;
+				Detail::radixOffsets(offset);
+				for (size_t i = 0; i < size; i++)
+				{
+					T value = source[i];
+					target[offset[(Detail::radixKey(value) >> (byte * 8)) & 0xFF]++] = value;
+				}
+				std::swap(source, target);
+			}
+
+			if (source != values.data()) std::memcpy(values.data(), source, size * sizeof(T));
+		}
+	}
+
+	/**
+	 * @brief Stable LSD radix sort of the indices, i.e. the permutation which sorts the values in ascending order. The values are not changed.
+	 *
+     * @code{.cpp}
+     * std::vector<float> keys;
+	 * std::vector<size_t> order = Utils::radixSortIndices(std::span<const float>(keys));
+	 * // keys[order[0]] <= keys[order[1]] <= ...
+     * @endcode
+	 *
+	 * @tparam T Integer, float or double.
+	 * @param[in] values Keys to be sorted.
+	 * @return Return the indices in the sorted order. Equal keys keep the order of index.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	std::vector<size_t> radixSortIndices(std::span<const T> values)
+	{
+		static_assert(is_radix_type<T>, "radixSortIndices only support integer, float and double.");
+		using K = Detail::RadixKey<T>;
+
+		size_t size = values.size();
+		std::vector<size_t> indices(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			indices[i] = i;
+		}
+		if (size < Detail::RADIX_SORT_MIN_SIZE)
+		{
+			std::stable_sort(indices.begin(), indices.end(),
+				[&values](size_t a, size_t b) { return Detail::radixKey(values[a]) < Detail::radixKey(values[b]); });
+			return indices;
+		}
+
+		constexpr size_t BYTES = sizeof(T);
+		std::vector<size_t> counts;
+		bool passNeeded[BYTES];
+		Detail::radixHistogram(values.data(), size, &counts, passNeeded);
+
+		// Sort the keys together with the indices, so the values are read only once
+		std::vector<K> keys(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			keys[i] = Detail::radixKey(values[i]);
+		}
+		std::vector<K> keyBuffer(size);
+		std::vector<size_t> indexBuffer(size);
+		for (size_t byte = 0; byte < BYTES; byte++)
+		{
+			if (!passNeeded[byte]) continue;
+
+			size_t* offset = counts.data() + byte * 256;
+			Detail::radixOffsets(offset);
+			for (size_t i = 0; i < size; i++)
+			{
+				size_t position = offset[(keys[i] >> (byte * 8)) & 0xFF]++;
+				keyBuffer[position] = keys[i];
+				indexBuffer[position] = indices[i];
+			}
+			keys.swap(keyBuffer);
+			indices.swap(indexBuffer);
+		}
+
+		return indices;
+	}
+
+	/**
+	 * @brief Stable LSD radix sort of the indices. See radixSortIndices(std::span<const T>).
+	 * @tparam T Integer, float or double.
+	 * @param[in] values Keys to be sorted.
+	 * @return Return the indices in the sorted order. Equal keys keep the order of index.
+     * @date 2026-10-16
+	*/
+	template <typename T>
+	std::vector<size_t> radixSortIndices(const std::vector<T>& values)
+	{
+		return radixSortIndices(std::span<const T>(values));
+	}
+
+	namespace Detail // Implementation details, not part of the API
+	{
+		/**
+		 * @brief Inputs smaller than this are sorted on the calling thread
+		*/
+		constexpr size_t PARALLEL_SORT_MIN_SIZE = (size_t)1 << 15;
+
+		/**
+		 * @brief Number of output values merged by one task
+		*/
+		constexpr size_t PARALLEL_MERGE_PART_SIZE = (size_t)1 << 16;
+
+		/**
+		 * @brief Co-rank of the merge path. Find i such that the first k values of the stable merge of a and b are a[0, i) and b[0, k - i).
+		 * Values of a are taken before the equal values of b.
+		 * @date 2026-10-16
+		*/
+		template <typename T, typename Compare>
+		size_t coRank(size_t k, const T* a, size_t sizeA, const T* b, size_t sizeB, Compare& compare)
+		{
+			size_t low = k > sizeB ? k - sizeB : 0;
+			size_t high = std::min(k, sizeA);
+			while (low < high)
+			{
+				size_t i = low + (high - low) / 2;
+				size_t j = k - i;
+				// a[i] has to be taken before b[j - 1], so i is too small
+				if (j > 0 && i < sizeA && !compare(b[j - 1], a[i])) low = i + 1;
+				else high = i;
+			}
+			return low;
+		}
+
+		/**
+		 * @brief Merge task of a round, i.e. output [first, last) of the merge of runs pair * 2 and pair * 2 + 1
+		*/
+		struct MergeTask
+		{
+			size_t pair;
+			size_t first;
+			size_t last;
+		};
+	}
+
+	/**
+	 * @brief Parallel merge sort without any dependency. The values are split into one run per thread which are sorted in parallel,
+	 * and then the runs are merged pairwise in rounds. Every merge is split into parts of the same size by binary search of the merge path,
+	 * so all threads are busy even in the last round.
+	 *
+     * @code{.cpp}
+     * std::vector<double> values;
+	 * Utils::parallelSort(std::span<double>(values));
+	 *
+	 * // Stable sort by a member on 4 threads
+	 * Utils::parallelSort(std::span<Item>(items), true, 4, [](const Item& a, const Item& b) { return a.time < b.time; });
+     * @endcode
+	 *
+	 * @tparam T Type of values. It must be movable and default constructible.
+	 * @tparam Compare bool(const T&, const T&), strict weak ordering.
+	 * @param[in, out] values Values to be sorted.
+	 * @param[in] stable (Option) Keep the order of equal values. Default as false.
+	 * @param[in] threadCount (Option) Number of threads. Default as 0 which use all hardware threads.
+	 * @param[in] compare (Option) Comparison. Default as std::less.
+     * @date 2026-10-16
+	*/
+	template <typename T, typename Compare = std::less<T>>
+	void parallelSort(std::span<T> values, bool stable = false, int threadCount = 0, Compare compare = Compare())
+	{
+		size_t size = values.size();
+		size_t threadSize = threadCount > 0 ? (size_t)threadCount : (size_t)std::max(1u, std::thread::hardware_concurrency());
+		size_t runCount = std::min(threadSize, size / Detail::PARALLEL_SORT_MIN_SIZE);
+		if (runCount <= 1)
+		{
+			if (stable) std::stable_sort(values.begin(), values.end(), compare);
+			else std::sort(values.begin(), values.end(), compare);
+			return;
+		}
+
+		// Sort runs
+		std::vector<size_t> bounds(runCount + 1);
+		for (size_t run = 0; run <= runCount; run++)
+		{
+			bounds[run] = size * run / runCount;
+		}
+		parallelFor(runCount, [&](size_t run)
+			{
+				if (stable) std::stable_sort(values.begin() + bounds[run], values.begin() + bounds[run + 1], compare);
+				else std::sort(values.begin() + bounds[run], values.begin() + bounds[run + 1], compare);
+			},
+			(int)threadSize
+		);
+
+		// Merge runs pairwise. An odd run at the end is moved as it is.
+		std::vector<T> buffer(size);
+		T* source = values.data();
+		T* target = buffer.data();
+		while (bounds.size() > 2)
+		{
+			size_t runs = bounds.size() - 1;
+			size_t pairCount = (runs + 1) / 2;
+			std::vector<Detail::MergeTask> tasks;
+			std::vector<size_t> nextBounds(1, 0);
+			for (size_t pair = 0; pair < pairCount; pair++)
+			{
+				size_t first = bounds[pair * 2];
+				size_t last = bounds[std::min(pair * 2 + 2, bounds.size() - 1)];
+				for (size_t part = first; part < last; part += Detail::PARALLEL_MERGE_PART_SIZE)
+				{
+					tasks.push_back({ pair, part, std::min(last, part + Detail::PARALLEL_MERGE_PART_SIZE) });
+				}
+				nextBounds.push_back(last);
+			}
+
+			parallelFor(tasks.size(), [&](size_t taskIndex)
+				{
+					const Detail::MergeTask& task = tasks[taskIndex];
+					size_t begin = bounds[task.pair * 2];
+					size_t middle = bounds[task.pair * 2 + 1];
+					size_t end = task.pair * 2 + 2 < bounds.size() ? bounds[task.pair * 2 + 2] : middle;
+					const T* a = source + begin;
+					const T* b = source + middle;
+					size_t sizeA = middle - begin;
+					size_t sizeB = end - middle;
+
+					size_t k0 = task.first - begin;
+					size_t k1 = task.last - begin;
+					size_t i0 = Detail::coRank(k0, a, sizeA, b, sizeB, compare);
+					size_t i1 = Detail::coRank(k1, a, sizeA, b, sizeB, compare);
+					std::merge(std::make_move_iterator(source + begin + i0), std::make_move_iterator(source + begin + i1),
+						std::make_move_iterator(source + middle + (k0 - i0)), std::make_move_iterator(source + middle + (k1 - i1)),
+						target + task.first, compare);
+				},
+				(int)threadSize
+			);
+
+			bounds.swap(nextBounds);
+			std::swap(source, target);
+		}
+
+		// Move back
+		if (source != values.data())
+		{
+			size_t partCount = (size + Detail::PARALLEL_MERGE_PART_SIZE - 1) / Detail::PARALLEL_MERGE_PART_SIZE;
+			parallelFor(partCount, [&](size_t part)
+				{
+					size_t first = part * Detail::PARALLEL_MERGE_PART_SIZE;
+					size_t last = std::min(size, first + Detail::PARALLEL_MERGE_PART_SIZE);
+					std::move(source + first, source + last, values.data() + first);
+				},
+				(int)threadSize
+			);
+		}
+	}
+
+	/**
+	 * @brief Sort values by their keys in parallel. Keys are sorted together with their indices by parallelSort(), and then the values are
+	 * moved into the sorted order once, so large values are not moved in every merge round.
+	 *
+     * @code{.cpp}
+     * std::vector<float> distances;
+	 * std::vector<cv::Point> points;
+	 * Utils::parallelSortByKey(std::span<float>(distances), std::span<cv::Point>(points));
+     * @endcode
+	 *
+	 * @tparam K Type of keys.
+	 * @tparam V Type of values. It must be movable and default constructible.
+	 * @tparam Compare bool(const K&, const K&), strict weak ordering.
+	 * @param[in, out] keys Keys to be sorted.
+	 * @param[in, out] values Values to be sorted by keys. It must have the same size as keys.
+	 * @param[in] stable (Option) Keep the order of values with equal keys. Default as false.
+	 * @param[in] threadCount (Option) Number of threads. Default as 0 which use all hardware threads.
+	 * @param[in] compare (Option) Comparison of keys. Default as std::less.
+	 * @return Return false if the sizes are different.
+     * @date 2026-10-16
+	*/
+	template <typename K, typename V, typename Compare = std::less<K>>
+	bool parallelSortByKey(std::span<K> keys, std::span<V> values, bool stable = false, int threadCount = 0, Compare compare = Compare())
+	{
+		size_t size = keys.size();
+		if (size != values.size()) return false;
+
+		// Sort keys with indices. Equal keys are ordered by index if stable, so the sort itself does not need to be stable.
+		std::vector<std::pair<K, size_t>> pairs(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			pairs[i] = std::pair<K, size_t>(std::move(keys[i]), i);
+		}
+		auto comparePair = [&compare, stable](const std::pair<K, size_t>& a, const std::pair<K, size_t>& b)
+		{
+			if (compare(a.first, b.first)) return true;
+			if (compare(b.first, a.first)) return false;
+			return stable && a.second < b.second;
+		};
+		parallelSort(std::span<std::pair<K, size_t>>(pairs), false, threadCount, comparePair);
+
+		// Gather
+		std::vector<V> sortedValues(size);
+		size_t partCount = (size + Detail::PARALLEL_MERGE_PART_SIZE - 1) / Detail::PARALLEL_MERGE_PART_SIZE;
+		parallelFor(partCount, [&](size_t part)
+			{
+				size_t first = part * Detail::PARALLEL_MERGE_PART_SIZE;
+				size_t last = std::min(size, first + Detail::PARALLEL_MERGE_PART_SIZE);
+				for (size_t i = first; i < last; i++)
+				{
+					keys[i] = std::move(pairs[i].first);
+					sortedValues[i] = std::move(values[pairs[i].second]);
+				}
+			},
+			threadCount
+		);
+		std::move(sortedValues.begin(), sortedValues.end(), values.begin());
+		return true;
+	}
+}
+
+
+//*******************************
+
+#endif
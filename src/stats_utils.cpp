@@ -0,0 +1,1084 @@
+#include <stats_utils.h>
+#include <cstring>
+#include <cassert>
+
+namespace Utils
+{
+#pragma region RunningStats
+
+	/**
+	 * @brief Construct an empty accumulator
+	 * @date 2026-10-16
+	*/
+	RunningStats::RunningStats()
+	{
+		reset();
+	}
+
+	/**
+	 * @brief Construct an accumulator from the result of describe()
+	 * @param statistics Statistics of the values
+	 * @date 2026-10-16
+	*/
+	RunningStats::RunningStats(const Statistics& statistics)
+	{
+		m_count = statistics.count;
+		m_mean = statistics.mean;
+		m_m2 = statistics.count > 1 ? statistics.variance * (double)(statistics.count - 1) : 0.0;
+		m_min = statistics.min;
+		m_max = statistics.max;
+	}
+
+	/**
+	 * @brief Push a value
+	 * @param value Value to be pushed
+	 * @date 2026-10-16
+	*/
+	void RunningStats::push(double value)
+	{
+		m_count++;
+		double delta = value - m_mean;
+		m_mean += delta / (double)m_count;
+		m_m2 += delta * (value - m_mean);
+
+		if (m_count == 1)
+		{
+			m_min = value;
+			m_max = value;
+		}
+		else
+		{
+			if (value < m_min) m_min = value;
+			if (value > m_max) m_max = value;
+		}
+	}
+
+	/**
+	 * @brief Merge another accumulator into this one (Chan's parallel algorithm)
+	 * @param other Accumulator to be merged
+	 * @date 2026-10-16
+	*/
+	void RunningStats::merge(const RunningStats& other)
+	{
+		if (other.m_count == 0) return;
+		if (m_count == 0)
+		{
+			*this = other;
+			return;
+		}
+
+		double count = (double)(m_count + other.m_count);
+		double delta = other.m_mean - m_mean;
+		m_mean += delta * (double)other.m_count / count;
+		m_m2 += other.m_m2 + delta * delta * (double)m_count * (double)other.m_count / count;
+		m_count += other.m_count;
+		if (other.m_min < m_min) m_min = other.m_min;
+		if (other.m_max > m_max) m_max = other.m_max;
+	}
+
+	/**
+	 * @brief Clear all pushed values
+	 * @date 2026-10-16
+	*/
+	void RunningStats::reset()
+	{
+		m_count = 0;
+		m_mean = 0.0;
+		m_m2 = 0.0;
+		m_min = 0.0;
+		m_max = 0.0;
+	}
+
+	/**
+	 * @brief Get the number of pushed values
+	 * @return Return the number of pushed values
+	 * @date 2026-10-16
+	*/
+	size_t RunningStats::getCount() const
+	{
+		return m_count;
+	}
+
+	/**
+	 * @brief Get the sum
+	 * @return Return the sum of pushed values
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getSum() const
+	{
+		return m_mean * (double)m_count;
+	}
+
+	/**
+	 * @brief Get the mean. Same as average().
+	 * @return Return the mean. Return 0 if no value was pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getMean() const
+	{
+		return m_mean;
+	}
+
+	/**
+	 * @brief Get the sample variance
+	 * @return Return the sample variance. Return 0 if less than 2 values were pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getVariance() const
+	{
+		return m_count > 1 ? m_m2 / (double)(m_count - 1) : 0.0;
+	}
+
+	/**
+	 * @brief Get the standard deviation. Same as stdev().
+	 * @return Return the standard deviation. Return 0 if less than 2 values were pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getStdev() const
+	{
+		return std::sqrt(getVariance());
+	}
+
+	/**
+	 * @brief Get the minimum value
+	 * @return Return the minimum value. Return 0 if no value was pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getMin() const
+	{
+		return m_min;
+	}
+
+	/**
+	 * @brief Get the maximum value
+	 * @return Return the maximum value. Return 0 if no value was pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningStats::getMax() const
+	{
+		return m_max;
+	}
+
+	/**
+	 * @brief Get all statistics at once
+	 * @return Return the statistics in the same form as describe()
+	 * @date 2026-10-16
+	*/
+	Statistics RunningStats::snapshot() const
+	{
+		Statistics result;
+		result.count = m_count;
+		result.sum = getSum();
+		result.mean = m_mean;
+		result.variance = getVariance();
+		result.stdev = std::sqrt(result.variance);
+		result.min = m_min;
+		result.max = m_max;
+		return result;
+	}
+
+#pragma endregion RunningStats
+
+#pragma region RunningPairStats
+
+	/**
+	 * @brief Construct an empty accumulator
+	 * @date 2026-10-16
+	*/
+	RunningPairStats::RunningPairStats()
+	{
+		reset();
+	}
+
+	/**
+	 * @brief Construct an accumulator from the result of describePair()
+	 * @param statistics Statistics of the pairs
+	 * @date 2026-10-16
+	*/
+	RunningPairStats::RunningPairStats(const PairStatistics& statistics)
+	{
+		double degree = statistics.count > 1 ? (double)(statistics.count - 1) : 0.0;
+		m_count = statistics.count;
+		m_meanX = statistics.meanX;
+		m_meanY = statistics.meanY;
+		m_m2X = statistics.varianceX * degree;
+		m_m2Y = statistics.varianceY * degree;
+		m_cXY = statistics.covariance * degree;
+	}
+
+	/**
+	 * @brief Push a pair
+	 * @param x Value of x
+	 * @param y Value of y
+	 * @date 2026-10-16
+	*/
+	void RunningPairStats::push(double x, double y)
+	{
+		m_count++;
+		double deltaX = x - m_meanX;
+		double deltaY = y - m_meanY;
+		m_meanX += deltaX / (double)m_count;
+		m_meanY += deltaY / (double)m_count;
+		m_m2X += deltaX * (x - m_meanX);
+		m_m2Y += deltaY * (y - m_meanY);
+		m_cXY += deltaX * (y - m_meanY);
+	}
+
+	/**
+	 * @brief Merge another accumulator into this one (Chan's parallel algorithm)
+	 * @param other Accumulator to be merged
+	 * @date 2026-10-16
+	*/
+	void RunningPairStats::merge(const RunningPairStats& other)
+	{
+		if (other.m_count == 0) return;
+		if (m_count == 0)
+		{
+			*this = other;
+			return;
+		}
+
+		double count = (double)(m_count + other.m_count);
+		double weight = (double)m_count * (double)other.m_count / count;
+		double deltaX = other.m_meanX - m_meanX;
+		double deltaY = other.m_meanY - m_meanY;
+		m_meanX += deltaX * (double)other.m_count / count;
+		m_meanY += deltaY * (double)other.m_count / count;
+		m_m2X += other.m_m2X + deltaX * deltaX * weight;
+		m_m2Y += other.m_m2Y + deltaY * deltaY * weight;
+		m_cXY += other.m_cXY + deltaX * deltaY * weight;
+		m_count += other.m_count;
+	}
+
+	/**
+	 * @brief Clear all pushed pairs
+	 * @date 2026-10-16
+	*/
+	void RunningPairStats::reset()
+	{
+		m_count = 0;
+		m_meanX = 0.0;
+		m_meanY = 0.0;
+		m_m2X = 0.0;
+		m_m2Y = 0.0;
+		m_cXY = 0.0;
+	}
+
+	/**
+	 * @brief Get the number of pushed pairs
+	 * @return Return the number of pushed pairs
+	 * @date 2026-10-16
+	*/
+	size_t RunningPairStats::getCount() const
+	{
+		return m_count;
+	}
+
+	/**
+	 * @brief Get the sample covariance
+	 * @return Return the sample covariance. Return 0 if less than 2 pairs were pushed.
+	 * @date 2026-10-16
+	*/
+	double RunningPairStats::getCovariance() const
+	{
+		return m_count > 1 ? m_cXY / (double)(m_count - 1) : 0.0;
+	}
+
+	/**
+	 * @brief Get the Pearson correlation coefficient
+	 * @return Return the correlation in [-1, 1]. Return 0 if the variance of x or y is 0.
+	 * @date 2026-10-16
+	*/
+	double RunningPairStats::getCorrelation() const
+	{
+		return snapshot().correlation;
+	}
+
+	/**
+	 * @brief Get the slope of the least squares line y = slope * x + intercept
+	 * @return Return the slope. Return 0 if the variance of x is 0.
+	 * @date 2026-10-16
+	*/
+	double RunningPairStats::getSlope() const
+	{
+		return snapshot().slope;
+	}
+
+	/**
+	 * @brief Get the intercept of the least squares line y = slope * x + intercept
+	 * @return Return the intercept. Return the mean of y if the variance of x is 0.
+	 * @date 2026-10-16
+	*/
+	double RunningPairStats::getIntercept() const
+	{
+		return snapshot().intercept;
+	}
+
+	/**
+	 * @brief Get all statistics at once
+	 * @return Return the statistics in the same form as describePair()
+	 * @date 2026-10-16
+	*/
+	PairStatistics RunningPairStats::snapshot() const
+	{
+		return Detail::makePairStatistics(m_count, m_meanX, m_meanY, m_m2X, m_m2Y, m_cXY);
+	}
+
+#pragma endregion RunningPairStats
+
+#pragma region PrefixSumTable
+
+	/**
+	 * @brief Construct an empty table
+	 * @date 2026-10-16
+	*/
+	PrefixSumTable::PrefixSumTable()
+	{
+		m_prefixSums.assign(1, 0.0);
+	}
+
+	/**
+	 * @brief Get the number of values in the table
+	 * @return Return the number of values
+	 * @date 2026-10-16
+	*/
+	size_t PrefixSumTable::getCount() const
+	{
+		return m_prefixSums.size() - 1;
+	}
+
+	/**
+	 * @brief Get the sum of values[first] to values[last - 1] in O(1)
+	 * @param first Index of the first value
+	 * @param last Index after the last value
+	 * @return Return the sum. Return 0 if the range is empty or out of range.
+	 * @date 2026-10-16
+	*/
+	double PrefixSumTable::getRangeSum(size_t first, size_t last) const
+	{
+		if (first >= last || last > getCount()) return 0.0;
+		return m_prefixSums[last] - m_prefixSums[first];
+	}
+
+	/**
+	 * @brief Get the mean of values[first] to values[last - 1] in O(1)
+	 * @param first Index of the first value
+	 * @param last Index after the last value
+	 * @return Return the mean. Return 0 if the range is empty or out of range.
+	 * @date 2026-10-16
+	*/
+	double PrefixSumTable::getRangeMean(size_t first, size_t last) const
+	{
+		if (first >= last || last > getCount()) return 0.0;
+		return (m_prefixSums[last] - m_prefixSums[first]) / (double)(last - first);
+	}
+
+#pragma endregion PrefixSumTable
+
+#pragma region RollingQuantile
+
+	/**
+	 * @brief Construct a rolling quantile
+	 * @param windowSize Number of latest values to be kept. It must be larger than 0.
+	 * @param probability (Option) Probability of the quantile in [0, 1]. Default as 0.5, i.e. median.
+	 * @date 2026-10-16
+	*/
+	RollingQuantile::RollingQuantile(size_t windowSize, double probability)
+	{
+		m_windowSize = windowSize > 0 ? windowSize : 1;
+		m_probability = std::min(1.0, std::max(0.0, probability));
+		reset();
+	}
+
+	/**
+	 * @brief Push a value. The oldest value will be removed if the window is full.
+	 * NaN is ignored, i.e. it is not pushed into the window, because it has no order in the sets.
+	 * @param value Value to be pushed
+	 * @date 2026-10-16
+	*/
+	void RollingQuantile::push(double value)
+	{
+		if (value != value) return;
+
+		if (m_window.size() < m_windowSize)
+		{
+			m_window.push_back(value);
+		}
+		else
+		{
+			erase(m_window[m_head]);
+			m_window[m_head] = value;
+			m_head = (m_head + 1) % m_windowSize;
+		}
+
+		insert(value);
+		rebalance();
+	}
+
+	/**
+	 * @brief Clear all pushed values
+	 * @date 2026-10-16
+	*/
+	void RollingQuantile::reset()
+	{
+		m_window.clear();
+		m_window.reserve(m_windowSize);
+		m_head = 0;
+		m_lower.clear();
+		m_upper.clear();
+	}
+
+	/**
+	 * @brief Get the number of values in the window
+	 * @return Return the number of values in the window
+	 * @date 2026-10-16
+	*/
+	size_t RollingQuantile::getCount() const
+	{
+		return m_window.size();
+	}
+
+	/**
+	 * @brief Get the quantile of the window
+	 * @return Return the quantile. Return 0 if no value was pushed.
+	 * @date 2026-10-16
+	*/
+	double RollingQuantile::getQuantile() const
+	{
+		size_t size = m_window.size();
+		if (size == 0) return 0.0;
+
+		double position = m_probability * (double)(size - 1);
+		double fraction = position - (double)(size_t)position;
+		double lowerValue = *m_lower.rbegin();
+		if (fraction > 0.0 && !m_upper.empty())
+		{
+			return lowerValue + fraction * (*m_upper.begin() - lowerValue);
+		}
+		return lowerValue;
+	}
+
+	/**
+	 * @brief Insert a value into the side it belongs to
+	 * @date 2026-10-16
+	*/
+	void RollingQuantile::insert(double value)
+	{
+		if (m_lower.empty() || value <= *m_lower.rbegin()) m_lower.insert(value);
+		else m_upper.insert(value);
+	}
+
+	/**
+	 * @brief Erase one copy of a value. All values in the lower set are not greater than the values in the upper set.
+	 * @date 2026-10-16
+	*/
+	void RollingQuantile::erase(double value)
+	{
+		std::multiset<double>& set = (!m_lower.empty() && value <= *m_lower.rbegin()) ? m_lower : m_upper;
+		auto position = set.find(value);
+		assert(position != set.end());
+		if (position != set.end()) set.erase(position);
+	}
+
+	/**
+	 * @brief Move values between the sets until the lower set ends at the lower rank of the quantile
+	 * @date 2026-10-16
+	*/
+	void RollingQuantile::rebalance()
+	{
+		size_t size = m_lower.size() + m_upper.size();
+		if (size == 0) return;
+
+		size_t lowerSize = (size_t)(m_probability * (double)(size - 1)) + 1;
+		while (m_lower.size() > lowerSize)
+		{
+			auto last = std::prev(m_lower.end());
+			m_upper.insert(*last);
+			m_lower.erase(last);
+		}
+		while (m_lower.size() < lowerSize)
+		{
+			auto first = m_upper.begin();
+			m_lower.insert(*first);
+			m_upper.erase(first);
+		}
+	}
+
+#pragma endregion RollingQuantile
+
+#pragma region RollingStats
+
+	/**
+	 * @brief Construct a rolling statistics
+	 * @param windowSize Number of latest values to be kept. It must be larger than 0.
+	 * @param trackMedian (Option) Track the median. Set as false to skip the O(log N) median update. Default as true.
+	 * @date 2026-10-16
+	*/
+	RollingStats::RollingStats(size_t windowSize, bool trackMedian) : m_median(windowSize)
+	{
+		m_windowSize = windowSize > 0 ? windowSize : 1;
+		m_trackMedian = trackMedian;
+		reset();
+	}
+
+	/**
+	 * @brief Push a value. The oldest value will be removed if the window is full.
+	 * Values which are not finite (NaN and inf) are ignored, because inf - inf in the update of the mean would make it NaN until the next recalculation.
+	 * They are not pushed into the median either, so the mean and the median are of the same window.
+	 * @param value Value to be pushed
+	 * @date 2026-10-16
+	*/
+	void RollingStats::push(double value)
+	{
+		if (!std::isfinite(value)) return;
+
+		if (m_trackMedian) m_median.push(value);
+
+		// Remove the oldest value
+		if (m_count == m_windowSize)
+		{
+			double oldest = m_window[m_head];
+			m_window[m_head] = value;
+			m_head = (m_head + 1) % m_windowSize;
+
+			m_count--;
+			if (m_count == 0)
+			{
+				m_mean = 0.0;
+				m_m2 = 0.0;
+			}
+			else
+			{
+				double delta = oldest - m_mean;
+				m_mean -= delta / (double)m_count;
+				m_m2 -= delta * (oldest - m_mean);
+			}
+		}
+		else
+		{
+			m_window.push_back(value);
+		}
+
+		// Add the new value
+		m_count++;
+		double delta = value - m_mean;
+		m_mean += delta / (double)m_count;
+		m_m2 += delta * (value - m_mean);
+
+		// Recalculate to stop drifting
+		m_updatesSinceRecalculate++;
+		if (m_updatesSinceRecalculate >= m_windowSize) recalculate();
+	}
+
+	/**
+	 * @brief Clear all pushed values
+	 * @date 2026-10-16
+	*/
+	void RollingStats::reset()
+	{
+		m_window.clear();
+		m_window.reserve(m_windowSize);
+		m_head = 0;
+		m_count = 0;
+		m_mean = 0.0;
+		m_m2 = 0.0;
+		m_updatesSinceRecalculate = 0;
+		m_median.reset();
+	}
+
+	/**
+	 * @brief Get the number of values in the window
+	 * @return Return the number of values in the window
+	 * @date 2026-10-16
+	*/
+	size_t RollingStats::getCount() const
+	{
+		return m_count;
+	}
+
+	/**
+	 * @brief Check whether the window is full
+	 * @return Return true if the window is full
+	 * @date 2026-10-16
+	*/
+	bool RollingStats::isFull() const
+	{
+		return m_count == m_windowSize;
+	}
+
+	/**
+	 * @brief Get the mean of the window
+	 * @return Return the mean. Return 0 if no value was pushed.
+	 * @date 2026-10-16
+	*/
+	double RollingStats::getMean() const
+	{
+		return m_mean;
+	}
+
+	/**
+	 * @brief Get the sample variance of the window
+	 * @return Return the sample variance. Return 0 if less than 2 values are in the window.
+	 * @date 2026-10-16
+	*/
+	double RollingStats::getVariance() const
+	{
+		return m_count > 1 ? std::max(0.0, m_m2) / (double)(m_count - 1) : 0.0;
+	}
+
+	/**
+	 * @brief Get the standard deviation of the window
+	 * @return Return the standard deviation. Return 0 if less than 2 values are in the window.
+	 * @date 2026-10-16
+	*/
+	double RollingStats::getStdev() const
+	{
+		return std::sqrt(getVariance());
+	}
+
+	/**
+	 * @brief Get the median of the window
+	 * @return Return the median. Return 0 if no value was pushed or the median is not tracked.
+	 * @date 2026-10-16
+	*/
+	double RollingStats::getMedian() const
+	{
+		return m_trackMedian ? m_median.getQuantile() : 0.0;
+	}
+
+	/**
+	 * @brief Recalculate mean and variance from the window in two passes
+	 * @date 2026-10-16
+	*/
+	void RollingStats::recalculate()
+	{
+		m_updatesSinceRecalculate = 0;
+		if (m_count == 0) return;
+
+		double sum = 0.0;
+		for (size_t i = 0; i < m_count; i++)
+		{
+			sum += m_window[i];
+		}
+		m_mean = sum / (double)m_count;
+
+		double m2 = 0.0;
+		for (size_t i = 0; i < m_count; i++)
+		{
+			double diff = m_window[i] - m_mean;
+			m2 += diff * diff;
+		}
+		m_m2 = m2;
+	}
+
+#pragma endregion RollingStats
+
+#pragma region QuantileSketch
+
+	/**
+	 * @brief Construct an empty sketch
+	 * @param k (Option) Capacity of the top level. A larger k gives smaller error with more memory. It must be at least 8. Default as 200.
+	 * @param seed (Option) Seed of the random choices of the compaction, so results are reproducible. Default as 0.
+	 * @date 2026-10-16
+	*/
+	QuantileSketch::QuantileSketch(uint32_t k, uint64_t seed)
+	{
+		m_k = std::max(k, (uint32_t)8);
+		m_randomState = seed * 0x9E3779B97F4A7C15ull + 0x2545F4914F6CDD1Dull;
+		reset();
+	}
+
+	/**
+	 * @brief Add a value. Values which are not finite (NaN and inf) are ignored, so the minimum and maximum of a sketch are always finite.
+	 * @param value Value to be added
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::add(double value)
+	{
+		if (!std::isfinite(value)) return;
+
+		if (m_count == 0)
+		{
+			m_min = value;
+			m_max = value;
+		}
+		else
+		{
+			if (value < m_min) m_min = value;
+			if (value > m_max) m_max = value;
+		}
+		m_count++;
+
+		m_compactors[0].push_back(value);
+		m_size++;
+		if (m_size >= m_maxSize) compress();
+	}
+
+	/**
+	 * @brief Merge another sketch into this one. The error is the same as a sketch of both streams.
+	 * @param other Sketch to be merged. Its k should be the same as this one.
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::merge(const QuantileSketch& other)
+	{
+		if (other.m_count == 0) return;
+
+		// Merging into itself would insert a vector into itself
+		if (&other == this)
+		{
+			QuantileSketch copy(other);
+			merge(copy);
+			return;
+		}
+
+		while (m_compactors.size() < other.m_compactors.size())
+		{
+			grow();
+		}
+		for (size_t level = 0; level < other.m_compactors.size(); level++)
+		{
+			m_compactors[level].insert(m_compactors[level].end(), other.m_compactors[level].begin(), other.m_compactors[level].end());
+		}
+		m_size += other.m_size;
+
+		if (m_count == 0)
+		{
+			m_min = other.m_min;
+			m_max = other.m_max;
+		}
+		else
+		{
+			m_min = std::min(m_min, other.m_min);
+			m_max = std::max(m_max, other.m_max);
+		}
+		m_count += other.m_count;
+
+		while (m_size >= m_maxSize)
+		{
+			compress();
+		}
+	}
+
+	/**
+	 * @brief Clear all added values
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::reset()
+	{
+		m_compactors.clear();
+		m_size = 0;
+		m_maxSize = 0;
+		m_count = 0;
+		m_min = 0.0;
+		m_max = 0.0;
+		grow();
+	}
+
+	/**
+	 * @brief Get the number of added values
+	 * @return Return the number of added values
+	 * @date 2026-10-16
+	*/
+	uint64_t QuantileSketch::getCount() const
+	{
+		return m_count;
+	}
+
+	/**
+	 * @brief Get the exact minimum value
+	 * @return Return the minimum value. Return 0 if no value was added.
+	 * @date 2026-10-16
+	*/
+	double QuantileSketch::getMin() const
+	{
+		return m_min;
+	}
+
+	/**
+	 * @brief Get the exact maximum value
+	 * @return Return the maximum value. Return 0 if no value was added.
+	 * @date 2026-10-16
+	*/
+	double QuantileSketch::getMax() const
+	{
+		return m_max;
+	}
+
+	/**
+	 * @brief Get the approximate quantile, i.e. the kept value at rank q * (count - 1) without interpolation.
+	 * It is exact until the first compaction, i.e. about 2 * k values.
+	 * @param probability Probability in [0, 1]
+	 * @return Return the quantile. Return 0 if no value was added or the probability is out of range.
+	 * @date 2026-10-16
+	*/
+	double QuantileSketch::quantile(double probability) const
+	{
+		std::vector<double> result = quantiles({ probability });
+		return result.empty() ? 0.0 : result[0];
+	}
+
+	/**
+	 * @brief Get several approximate quantiles. The kept values are sorted once. See quantile().
+	 * @param probabilities Probabilities in [0, 1]
+	 * @return Return quantiles in the order of probabilities. Return empty vector if no value was added or any probability is out of range.
+	 * @date 2026-10-16
+	*/
+	std::vector<double> QuantileSketch::quantiles(const std::vector<double>& probabilities) const
+	{
+		if (m_count == 0) return std::vector<double>();
+		for (double probability : probabilities)
+		{
+			if (!(probability >= 0.0 && probability <= 1.0)) return std::vector<double>();
+		}
+
+		std::vector<std::pair<double, uint64_t>> values = weightedValues();
+		std::vector<double> result(probabilities.size());
+		for (size_t i = 0; i < probabilities.size(); i++)
+		{
+			if (probabilities[i] == 0.0)
+			{
+				result[i] = m_min;
+				continue;
+			}
+			if (probabilities[i] == 1.0)
+			{
+				result[i] = m_max;
+				continue;
+			}
+
+			// First value which cumulative weight is larger than the rank
+			double targetRank = probabilities[i] * (double)(m_count - 1);
+			uint64_t cumulative = 0;
+			result[i] = m_max;
+			for (const auto& value : values)
+			{
+				cumulative += value.second;
+				if ((double)cumulative > targetRank)
+				{
+					result[i] = value.first;
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Get the approximate normalized rank of a value, i.e. the fraction of added values which are not greater than value
+	 * @param value Value to be ranked
+	 * @return Return the rank in [0, 1]. Return 0 if no value was added.
+	 * @date 2026-10-16
+	*/
+	double QuantileSketch::rank(double value) const
+	{
+		if (m_count == 0) return 0.0;
+
+		uint64_t weight = 0;
+		for (size_t level = 0; level < m_compactors.size(); level++)
+		{
+			for (double kept : m_compactors[level])
+			{
+				if (kept <= value) weight += (uint64_t)1 << level;
+			}
+		}
+		return (double)weight / (double)m_count;
+	}
+
+	/**
+	 * @brief Serialize the sketch into bytes. The format is little-endian on all supported platforms:
+	 * "JWQS", version (uint8), k (uint32), seed state (uint64), count (uint64), min (double), max (double), level count (uint32),
+	 * and for each level its size (uint32) followed by its values (double).
+	 * @return Return the bytes
+	 * @date 2026-10-16
+	*/
+	std::vector<uint8_t> QuantileSketch::serialize() const
+	{
+		std::vector<uint8_t> bytes;
+		bytes.reserve(45 + m_compactors.size() * 4 + m_size * sizeof(double));
+		auto write = [&bytes](const void* data, size_t size)
+		{
+			const uint8_t* begin = (const uint8_t*)data;
+			bytes.insert(bytes.end(), begin, begin + size);
+		};
+
+		const uint8_t VERSION = 1;
+		uint32_t levelCount = (uint32_t)m_compactors.size();
+		write("JWQS", 4);
+		write(&VERSION, sizeof(VERSION));
+		write(&m_k, sizeof(m_k));
+		write(&m_randomState, sizeof(m_randomState));
+		write(&m_count, sizeof(m_count));
+		write(&m_min, sizeof(m_min));
+		write(&m_max, sizeof(m_max));
+		write(&levelCount, sizeof(levelCount));
+		for (const std::vector<double>& compactor : m_compactors)
+		{
+			uint32_t size = (uint32_t)compactor.size();
+			write(&size, sizeof(size));
+			write(compactor.data(), size * sizeof(double));
+		}
+		return bytes;
+	}
+
+	/**
+	 * @brief Restore the sketch from the bytes of serialize()
+	 * @param bytes Bytes of serialize()
+	 * @return Return false if the bytes are not a valid sketch, i.e. the total weight of the levels is not the count, the minimum and maximum
+	 * are not finite or in order, or any value is out of them. The sketch is not changed in this case.
+	 * @date 2026-10-16
+	*/
+	bool QuantileSketch::deserialize(std::span<const uint8_t> bytes)
+	{
+		size_t offset = 0;
+		auto read = [&](void* data, size_t size)
+		{
+			if (bytes.size() - offset < size) return false;
+			if (size == 0) return true; // data of an empty level may be NULL
+			std::memcpy(data, bytes.data() + offset, size);
+			offset += size;
+			return true;
+		};
+
+		char magic[4];
+		uint8_t version;
+		QuantileSketch sketch;
+		uint32_t levelCount;
+		if (!read(magic, 4) || std::memcmp(magic, "JWQS", 4) != 0) return false;
+		if (!read(&version, sizeof(version)) || version != 1) return false;
+		if (!read(&sketch.m_k, sizeof(sketch.m_k)) || sketch.m_k < 8) return false;
+		if (!read(&sketch.m_randomState, sizeof(sketch.m_randomState))) return false;
+		if (!read(&sketch.m_count, sizeof(sketch.m_count))) return false;
+		if (!read(&sketch.m_min, sizeof(sketch.m_min)) || !read(&sketch.m_max, sizeof(sketch.m_max))) return false;
+		if (!read(&levelCount, sizeof(levelCount)) || levelCount == 0 || levelCount > 64) return false;
+
+		sketch.m_compactors.clear();
+		sketch.m_maxSize = 0;
+		while (sketch.m_compactors.size() < levelCount)
+		{
+			sketch.grow();
+		}
+		sketch.m_size = 0;
+		uint64_t weight = 0; // Sum of size * 2^level, which must be the count
+		for (uint32_t level = 0; level < levelCount; level++)
+		{
+			uint32_t size;
+			if (!read(&size, sizeof(size)) || (bytes.size() - offset) / sizeof(double) < size) return false;
+			sketch.m_compactors[level].resize(size);
+			read(sketch.m_compactors[level].data(), size * sizeof(double));
+			sketch.m_size += size;
+
+			if (size > (UINT64_MAX - weight) >> level) return false;
+			weight += (uint64_t)size << level;
+		}
+		if (offset != bytes.size()) return false;
+		if (weight != sketch.m_count) return false;
+
+		if (sketch.m_count > 0)
+		{
+			if (!std::isfinite(sketch.m_min) || !std::isfinite(sketch.m_max) || sketch.m_min > sketch.m_max) return false;
+			for (const std::vector<double>& compactor : sketch.m_compactors)
+			{
+				for (double value : compactor)
+				{
+					if (!(value >= sketch.m_min && value <= sketch.m_max)) return false;
+				}
+			}
+		}
+		else if (sketch.m_min != 0.0 || sketch.m_max != 0.0) return false;
+
+		*this = std::move(sketch);
+		return true;
+	}
+
+	/**
+	 * @brief Capacity of a level. The top level has capacity k, and each lower level has 2/3 of the level above.
+	 * @date 2026-10-16
+	*/
+	uint32_t QuantileSketch::capacity(size_t level) const
+	{
+		size_t depth = m_compactors.size() - level - 1;
+		return (uint32_t)std::ceil((double)m_k * std::pow(2.0 / 3.0, (double)depth)) + 1;
+	}
+
+	/**
+	 * @brief Add a level on top
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::grow()
+	{
+		m_compactors.emplace_back();
+		m_maxSize = 0;
+		for (size_t level = 0; level < m_compactors.size(); level++)
+		{
+			m_maxSize += capacity(level);
+		}
+	}
+
+	/**
+	 * @brief Compact the lowest full level, and the levels above if the sketch is still full
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::compress()
+	{
+		for (size_t level = 0; level < m_compactors.size(); level++)
+		{
+			if (m_compactors[level].size() >= capacity(level))
+			{
+				if (level + 1 >= m_compactors.size()) grow();
+				compact(level);
+				if (m_size < m_maxSize) break;
+			}
+		}
+	}
+
+	/**
+	 * @brief Sort a level and promote the values at the odd or even positions, chosen at random, to the next level.
+	 * The last value is kept if the size is odd.
+	 * @date 2026-10-16
+	*/
+	void QuantileSketch::compact(size_t level)
+	{
+		std::vector<double>& compactor = m_compactors[level];
+		std::sort(compactor.begin(), compactor.end());
+
+		// xorshift64
+		m_randomState ^= m_randomState << 13;
+		m_randomState ^= m_randomState >> 7;
+		m_randomState ^= m_randomState << 17;
+		size_t offset = (size_t)(m_randomState >> 63);
+
+		size_t pairCount = compactor.size() / 2;
+		std::vector<double>& next = m_compactors[level + 1];
+		for (size_t i = 0; i < pairCount; i++)
+		{
+			next.push_back(compactor[2 * i + offset]);
+		}
+
+		bool hasLast = compactor.size() % 2 == 1;
+		double last = hasLast ? compactor.back() : 0.0;
+		compactor.clear();
+		if (hasLast) compactor.push_back(last);
+		m_size -= pairCount;
+	}
+
+	/**
+	 * @brief Get all kept values with their weights, sorted by value
+	 * @date 2026-10-16
+	*/
+	std::vector<std::pair<double, uint64_t>> QuantileSketch::weightedValues() const
+	{
+		std::vector<std::pair<double, uint64_t>> values;
+		values.reserve(m_size);
+		for (size_t level = 0; level < m_compactors.size(); level++)
+		{
+			for (double value : m_compactors[level])
+			{
+				values.emplace_back(value, (uint64_t)1 << level);
+			}
+		}
+		std::sort(values.begin(), values.end());
+		return values;
+	}
+
+#pragma endregion QuantileSketch
+}
@@ -6,6 +6,9 @@
 #include <atomic>
 #include <thread>
 #include <functional>
+#include <vector>
+#include <exception>
+#include <algorithm>
 
 namespace Utils
 {
@@ -16,7 +19,82 @@ namespace Utils
     bool waitingForFinish(std::atomic<bool>* stopWaiting, std::function<void()> func, int delayms = 10, int timeout = 3000);
     bool waitingForFinish(std::atomic<bool>* stopWaiting, std::function<void(std::atomic<bool>*)> func, int delayms = 10, int timeout = 3000);
 
-    
+    // parallelFor
+
+    /**
+     * @brief Run func(taskIndex) for every taskIndex in [0, taskCount) on several threads and wait for all of them.
+     * Tasks are handed out one by one, so the thread which runs a task is not fixed. Results must be written by task index
+     * if the output has to be independent of the thread count.
+     *
+     * @code{.cpp}
+     * std::vector<double> partialSums(blockCount);
+     * Utils::parallelFor(blockCount, [&](size_t block)
+     *     {
+     *         partialSums[block] = sumOfBlock(block);
+     *     }
+     * );
+     * @endcode
+     *
+     * @tparam Func void(size_t taskIndex)
+     * @param[in] taskCount Number of tasks
+     * @param[in] func Function to run each task. The first exception thrown will be rethrown after all threads finished.
+     * @param[in] threadCount (Option) Number of threads including the calling thread. Default as 0 which use all hardware threads.
+     * @date 2026-10-16
+     */
+    template <typename Func>
+    void parallelFor(size_t taskCount, Func func, int threadCount = 0)
+    {
+        // Get thread size
+        size_t threadSize = threadCount > 0 ? (size_t)threadCount : (size_t)std::max(1u, std::thread::hardware_concurrency());
+        threadSize = std::min(threadSize, taskCount);
+
+        // Single thread
+        if (threadSize <= 1)
+        {
+            for (size_t i = 0; i < taskCount; i++)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        // Multiple threads
+        std::atomic<size_t> nextTask = 0;
+        std::exception_ptr exception = NULL;
+        std::atomic<bool> hasException = false;
+        auto worker = [&]()
+        {
+            size_t task;
+            while ((task = nextTask.fetch_add(1)) < taskCount)
+            {
+                try
+                {
+                    func(task);
+                }
+                catch (...)
+                {
+                    // Keep the first exception and stop handing out tasks
+                    if (!hasException.exchange(true)) exception = std::current_exception();
+                    nextTask = taskCount;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadSize - 1);
+        for (size_t i = 0; i < threadSize - 1; i++)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (size_t i = 0; i < threads.size(); i++)
+        {
+            threads[i].join();
+        }
+
+        // Rethrow
+        if (exception) std::rethrow_exception(exception);
+    }
 }
 
 
@@ -0,0 +1,109 @@
+// Tests of math_utils.h without any test framework. Build from the repository root, e.g.
+// g++ -std=c++20 -Isrc tests/math_utils_tests.cpp src/simd_utils.cpp -o math_utils_tests -pthread
+// Return the number of failed checks.
+
+#include <math_utils.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	int failedCount = 0;
+
+	void check(bool passed, const char* name)
+	{
+		if (!passed)
+		{
+			printf("FAILED: %s\n", name);
+			failedCount++;
+		}
+	}
+
+	void testElementwiseInteger()
+	{
+		// Widening: the product does not fit in int
+		std::vector<int64_t> product = Utils::multiple<int64_t>(std::vector<int>{ 100000, -100000 }, std::vector<int>{ 100000, 100000 });
+		check(product == std::vector<int64_t>{ 10000000000LL, -10000000000LL }, "multiple<int64_t>(int, int) widens");
+
+		std::vector<int64_t> sum = Utils::addition<int64_t>(std::vector<int>{ INT32_MAX }, std::vector<int>{ INT32_MAX });
+		check(sum == std::vector<int64_t>{ 2LL * INT32_MAX }, "addition<int64_t>(int, int) widens");
+
+		std::vector<uint64_t> unsignedProduct = Utils::multiple<uint64_t>(std::vector<uint32_t>{ UINT32_MAX }, std::vector<uint32_t>{ UINT32_MAX });
+		check(unsignedProduct == std::vector<uint64_t>{ (uint64_t)UINT32_MAX * UINT32_MAX }, "multiple<uint64_t>(uint32_t, uint32_t) widens");
+
+		// Mixed signs
+		std::vector<int64_t> mixedSum = Utils::addition<int64_t>(std::vector<int>{ -5 }, std::vector<unsigned>{ 3 });
+		check(mixedSum == std::vector<int64_t>{ -2 }, "addition<int64_t>(int, unsigned) keeps the sign");
+
+		std::vector<int64_t> mixedDifference = Utils::subtraction<int64_t>(std::vector<unsigned>{ 3 }, std::vector<int>{ 5 });
+		check(mixedDifference == std::vector<int64_t>{ -2 }, "subtraction<int64_t>(unsigned, int) keeps the sign");
+
+		std::vector<int64_t> mixedProduct = Utils::multiple<int64_t>(std::vector<int64_t>{ -3 }, std::vector<uint64_t>{ 4000000000ULL });
+		check(mixedProduct == std::vector<int64_t>{ -12000000000LL }, "multiple<int64_t>(int64_t, uint64_t) keeps the sign");
+
+		std::vector<int> quotient = Utils::divideBy<int>(std::vector<int>{ -7 }, std::vector<unsigned>{ 2 });
+		check(quotient == std::vector<int>{ -3 }, "divideBy<int>(int, unsigned) keeps the sign");
+
+		// Overflow of R wraps around
+		std::vector<int32_t> wrapped = Utils::addition<int32_t>(std::vector<int32_t>{ INT32_MAX }, std::vector<int64_t>{ 1 });
+		check(wrapped == std::vector<int32_t>{ INT32_MIN }, "addition<int32_t> wraps around");
+	}
+
+	void testExpressionPrecision()
+	{
+		// Expressions are calculated in double, so 64-bit integers above 2^53 are rounded, while addition() is exact
+		std::vector<int64_t> large = { (1LL << 53) + 1 };
+		std::vector<int64_t> zero = { 0 };
+		std::vector<int64_t> lazySum = Utils::evaluate<int64_t>(Utils::expression(large) + zero);
+		std::vector<int64_t> exactSum = Utils::addition<int64_t>(large, zero);
+		check(lazySum == std::vector<int64_t>{ 1LL << 53 }, "expression rounds int64_t through double");
+		check(exactSum == std::vector<int64_t>{ (1LL << 53) + 1 }, "addition<int64_t> is exact");
+	}
+
+	void testSigmaClip()
+	{
+		// Infinity is rejected and does not turn the sums into NaN
+		std::vector<double> withInfinity;
+		for (int i = 0; i < 100; i++)
+		{
+			withInfinity.push_back(i % 7);
+		}
+		withInfinity.push_back(std::numeric_limits<double>::infinity());
+		withInfinity.push_back(-std::numeric_limits<double>::infinity());
+		withInfinity.push_back(std::numeric_limits<double>::quiet_NaN());
+		Utils::BitMask rejected;
+		Utils::Statistics clipped = Utils::sigmaClip(withInfinity, 3.0, 5, &rejected);
+		Utils::Statistics expected = Utils::describe(std::span<const double>(withInfinity.data(), 100));
+		check(clipped.count == 100, "sigmaClip rejects inf and NaN");
+		check(fabs(clipped.mean - expected.mean) < 1e-12 && fabs(clipped.stdev - expected.stdev) < 1e-12, "sigmaClip statistics without inf");
+		check(rejected.test(100) && rejected.test(101) && rejected.test(102) && !rejected.test(0), "sigmaClip mask of inf and NaN");
+
+		// A huge outlier does not cancel the sums of the remaining values
+		std::mt19937 random(1);
+		std::normal_distribution<double> normal(0.0, 1.0);
+		std::vector<double> samples(1000);
+		for (double& sample : samples)
+		{
+			sample = normal(random);
+		}
+		expected = Utils::describe(samples);
+		samples.push_back(1e15);
+		clipped = Utils::sigmaClip(samples, 5.0);
+		check(clipped.count == 1000, "sigmaClip rejects a huge outlier");
+		check(fabs(clipped.mean - expected.mean) < 1e-9 && fabs(clipped.stdev - expected.stdev) < 1e-9, "sigmaClip statistics without a huge outlier");
+	}
+}
+
+int main()
+{
+	testElementwiseInteger();
+	testExpressionPrecision();
+	testSigmaClip();
+
+	printf("%d check(s) failed\n", failedCount);
+	return failedCount;
+}
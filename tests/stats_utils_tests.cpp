@@ -0,0 +1,93 @@
+// Tests of stats_utils.h without any test framework. Build from the repository root, e.g.
+// g++ -std=c++20 -Isrc tests/stats_utils_tests.cpp src/stats_utils.cpp src/simd_utils.cpp -o stats_utils_tests -pthread
+// Return the number of failed checks.
+
+#include <stats_utils.h>
+#include <stdio.h>
+#include <math.h>
+#include <limits>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	int failedCount = 0;
+
+	void check(bool passed, const char* name)
+	{
+		if (!passed)
+		{
+			printf("FAILED: %s\n", name);
+			failedCount++;
+		}
+	}
+
+	void testRollingStats()
+	{
+		// Infinity is ignored and does not leave the mean and stdev as NaN
+		const size_t WINDOW_SIZE = 10;
+		Utils::RollingStats stats(WINDOW_SIZE);
+		stats.push(1.0);
+		stats.push(std::numeric_limits<double>::infinity());
+		stats.push(-std::numeric_limits<double>::infinity());
+		stats.push(std::numeric_limits<double>::quiet_NaN());
+		check(stats.getCount() == 1 && stats.getMean() == 1.0, "RollingStats ignores non-finite values");
+
+		for (size_t i = 0; i < WINDOW_SIZE; i++)
+		{
+			stats.push((double)i);
+		}
+		check(stats.getCount() == WINDOW_SIZE, "RollingStats window is full");
+		check(fabs(stats.getMean() - 4.5) < 1e-12, "RollingStats mean after inf");
+		check(fabs(stats.getStdev() - sqrt(55.0 / 6.0)) < 1e-12, "RollingStats stdev after inf");
+		check(stats.getMedian() == 4.5, "RollingStats median after inf");
+	}
+
+	void testQuantileSketchDeserialize()
+	{
+		Utils::QuantileSketch sketch;
+		for (int i = 0; i < 10000; i++)
+		{
+			sketch.add((double)(i % 1000));
+		}
+		sketch.add(std::numeric_limits<double>::infinity());
+		std::vector<uint8_t> bytes = sketch.serialize();
+
+		Utils::QuantileSketch restored;
+		check(restored.deserialize(bytes) && restored.getCount() == 10000 && restored.getMax() == 999.0, "QuantileSketch round trip");
+
+		// Layout: magic (4), version (1), k (4), random state (8), count (8), min (8), max (8), level count (4), levels
+		const size_t COUNT_OFFSET = 17;
+		const size_t MIN_OFFSET = 25;
+		const size_t MAX_OFFSET = 33;
+		auto corrupted = [&](size_t offset, auto value)
+		{
+			std::vector<uint8_t> copy = bytes;
+			std::memcpy(copy.data() + offset, &value, sizeof(value));
+			return copy;
+		};
+
+		Utils::QuantileSketch target;
+		target.add(1.0);
+		bool anyAccepted = false;
+		anyAccepted |= target.deserialize(corrupted(COUNT_OFFSET, (uint64_t)10001));
+		anyAccepted |= target.deserialize(corrupted(COUNT_OFFSET, (uint64_t)0));
+		anyAccepted |= target.deserialize(corrupted(MIN_OFFSET, 1000.0));
+		anyAccepted |= target.deserialize(corrupted(MIN_OFFSET, 1.0));
+		anyAccepted |= target.deserialize(corrupted(MAX_OFFSET, 500.0));
+		anyAccepted |= target.deserialize(corrupted(MAX_OFFSET, std::numeric_limits<double>::infinity()));
+		anyAccepted |= target.deserialize(corrupted(MIN_OFFSET, std::numeric_limits<double>::quiet_NaN()));
+		anyAccepted |= target.deserialize(corrupted(bytes.size() - sizeof(double), std::numeric_limits<double>::quiet_NaN()));
+		check(!anyAccepted, "QuantileSketch rejects corrupted count, minimum, maximum and values");
+		check(target.getCount() == 1 && target.getMin() == 1.0 && target.getMax() == 1.0, "QuantileSketch is not changed by a rejected deserialize");
+	}
+}
+
+int main()
+{
+	testRollingStats();
+	testQuantileSketchDeserialize();
+
+	printf("%d check(s) failed\n", failedCount);
+	return failedCount;
+}